@@ -2,13 +2,18 @@
 * Author:			Molli Drivdahl
 * Filename:			array.h
 * Date Created:		1/4/16
-* Modifications:	1/5/16
+* Modifications:	10/17/26
 *
 * Class: Array
 *
 * Purpose:
 *	This class creates a dynamic one-dimensional array with a starting
-*	index of any value.
+*	index of any value. The Bounds policy (see bounds.h) decides how
+*	operator[] checks indices. The Array keeps a capacity separate
+*	from its length: the dynamic array may hold more elements than are
+*	in use, so growing by push_back() or resize() only reallocates when
+*	the capacity runs out, and then doubles it. Elements of trivially
+*	copyable types (such as Card) are copied with memcpy.
 *
 * Manager functions:
 *	Array()
@@ -21,14 +26,32 @@
 *
 *	Array(const Array & copy)
 *
+*	Array(Array && other)
+*		Takes over the dynamic array of other without copying, and
+*		leaves other empty.
+*
 *	~Array()
 *
 *	Array & operator=(const Array & rhs)
+*		Copies the elements of rhs, reusing this Array's dynamic array
+*		if it is already big enough.
+*
+*	Array & operator=(Array && rhs)
+*		Frees this Array's data and takes over the dynamic array of rhs
+*		without copying, leaving rhs empty.
 *
 * Methods:
+*	void Swap(Array & other)
+*		Exchanges the contents of two Arrays without copying elements.
+*
 *	T & operator[](int index) const
 *		Overloads the [] operator in order to work with Arrays of
-*		varying starting indices.
+*		varying starting indices. The index is checked by the Bounds
+*		policy (see bounds.h).
+*
+*	T & at(int index) const
+*		Returns the element at the index like operator[], but always
+*		checks the index and throws an Exception if it is out of range.
 *
 *	int getStartIndex() const
 *		Returns value of the starting index.
@@ -40,15 +63,38 @@
 *		Returns value of the length.
 *
 *	void setLength(int length)
-*		Sets value of the length.
+*		Sets value of the length (same as resize()).
+*
+*	int getCapacity() const
+*		Returns the number of elements the Array can hold before it
+*		has to reallocate.
+*
+*	void reserve(int capacity)
+*		Makes room for at least the given number of elements without
+*		changing the length.
+*
+*	void resize(int length)
+*		Changes the length, growing the capacity geometrically if
+*		needed. New elements are default values.
+*
+*	void push_back(const T & data)
+*		Adds an element after the last element, growing the capacity
+*		geometrically if needed.
 **********************************************************************/
 
 #ifndef ARRAY_H
 #define ARRAY_H
 
 #include "exception.h"
+#include "bounds.h"
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
-template <typename T>
+const int ARRAY_MIN_CAPACITY = 8;	//Capacity given to an empty Array the first time it grows
+
+template <typename T, typename Bounds = DefaultBounds>
 class Array
 {
 public:
@@ -59,17 +105,29 @@ public:
 	Array(int length, int start_index = 0);
 
 	//Copy Ctor
-	Array(const Array<T> & copy);
+	Array(const Array<T, Bounds> & copy);
+
+	//Move Ctor
+	Array(Array<T, Bounds> && other) noexcept;
 
 	//Default Dtor
 	~Array();
 
 	//Assignment Operator
-	Array<T> & operator=(const Array<T> & rhs);
+	Array<T, Bounds> & operator=(const Array<T, Bounds> & rhs);
+
+	//Move Assignment Operator
+	Array<T, Bounds> & operator=(Array<T, Bounds> && rhs) noexcept;
 
-	//Overloaded [] Operator
+	//Exchanges the contents of two Arrays
+	void Swap(Array<T, Bounds> & other) noexcept;
+
+	//Overloaded [] Operator (checked by the Bounds policy)
 	T & operator[](int index) const;
 
+	//Returns an element, always checked
+	T & at(int index) const;
+
 	//Getters for m_start_index and m_length
 	int getStartIndex() const;
 	int getLength() const;
@@ -78,9 +136,32 @@ public:
 	void setStartIndex(int start_index);
 	void setLength(int length);
 
+	//Getter for m_capacity
+	int getCapacity() const;
+
+	//Makes room for at least capacity elements
+	void reserve(int capacity);
+
+	//Changes the length, growing geometrically
+	void resize(int length);
+
+	//Adds an element after the last element, growing geometrically
+	void push_back(const T & data);
+
 private:
+	//Copies elements between dynamic arrays (memcpy for trivially copyable types)
+	static void CopyElements(T * destination, const T * source, int count);
+	static void CopyElements(T * destination, const T * source, int count, std::true_type);
+	static void CopyElements(T * destination, const T * source, int count, std::false_type);
+
+	//Moves elements into a new dynamic array (memcpy for trivially copyable types)
+	static void MoveElements(T * destination, T * source, int count);
+	static void MoveElements(T * destination, T * source, int count, std::true_type);
+	static void MoveElements(T * destination, T * source, int count, std::false_type);
+
 	T * m_array;		//Pointer to the dynamic array of data
 	int m_length;		//Number of elements
+	int m_capacity;		//Number of elements the dynamic array has room for
 	int m_start_index;	//Starting index (base element)
 };
 
@@ -95,8 +176,8 @@ private:
 * Postcondition:
 *	Data members are initialized to default values.
 **********************************************************************/
-template <typename T>
-Array<T>::Array() : m_array(nullptr), m_length(0),
+template <typename T, typename Bounds>
+Array<T, Bounds>::Array() : m_array(nullptr), m_length(0), m_capacity(0),
 m_start_index(0)
 {}
 
@@ -113,9 +194,9 @@ m_start_index(0)
 *	The data members are initialized to the values of the parameters,
 *	if desired length is not negative.
 **********************************************************************/
-template <typename T>
-Array<T>::Array(int length, int start_index) : m_array(nullptr),
-m_length(length), m_start_index(start_index)
+template <typename T, typename Bounds>
+Array<T, Bounds>::Array(int length, int start_index) : m_array(nullptr),
+m_length(length), m_capacity(0), m_start_index(start_index)
 {
 	//If length is negative
 	if (m_length < 0)
@@ -133,6 +214,7 @@ m_length(length), m_start_index(start_index)
 	else
 	{
 		m_array = new T[m_length];
+		m_capacity = m_length;
 	}
 }
 
@@ -149,11 +231,40 @@ m_length(length), m_start_index(start_index)
 *	The data members are initialized to the values of the data members
 *	of the existing Array object.
 **********************************************************************/
-template <typename T>
-Array<T>::Array(const Array<T> & copy) : m_array(nullptr),
-m_length(copy.m_length), m_start_index(copy.m_start_index)
+template <typename T, typename Bounds>
+Array<T, Bounds>::Array(const Array<T, Bounds> & copy) : m_array(nullptr),
+m_length(copy.m_length), m_capacity(copy.m_length), m_start_index(copy.m_start_index)
 {
-	*this = copy;	//Use assignment operator
+	//Copy elements once, straight into a new array of the same length
+	if (m_length > 0)
+	{
+		m_array = new T[m_length];
+
+		CopyElements(m_array, copy.m_array, m_length);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of an Array that takes over the dynamic
+*	array of an existing Array object instead of copying it.
+*
+* Precondition:
+*	An existing Array object that is about to be discarded.
+*
+* Postcondition:
+*	This Array holds the data of the other Array, and the other Array
+*	is empty with length zero.
+**********************************************************************/
+template <typename T, typename Bounds>
+Array<T, Bounds>::Array(Array<T, Bounds> && other) noexcept : m_array(other.m_array),
+m_length(other.m_length), m_capacity(other.m_capacity), m_start_index(other.m_start_index)
+{
+	//Leave other empty so its Dtor does not free the data
+	other.m_array = nullptr;
+	other.m_length = 0;
+	other.m_capacity = 0;
+	other.m_start_index = 0;
 }
 
 /**********************************************************************
@@ -167,21 +278,24 @@ m_length(copy.m_length), m_start_index(copy.m_start_index)
 * Postcondition:
 *	Data members are re-initialized to default values.
 **********************************************************************/
-template <typename T>
-Array<T>::~Array()
+template <typename T, typename Bounds>
+Array<T, Bounds>::~Array()
 {
 	delete[] m_array;
 
 	//Reset to default values
 	m_array = nullptr;
 	m_length = 0;
+	m_capacity = 0;
 	m_start_index = 0;
 }
 
 /**********************************************************************
 * Purpose:
 *	To assign one existing Array object to another existing Array
-*	object by copying values of data members from one to another.
+*	object by copying values of data members from one to another. If
+*	this Array's dynamic array already has room for the elements of
+*	the other Array, it is reused instead of reallocated.
 *
 * Precondition:
 *	An existing Array object passed by const ref.
@@ -190,34 +304,97 @@ Array<T>::~Array()
 *	One existing Array object is assigned to another existing Array
 *	object.
 **********************************************************************/
-template <typename T>
-Array<T> & Array<T>::operator=(const Array<T> & rhs)
+template <typename T, typename Bounds>
+Array<T, Bounds> & Array<T, Bounds>::operator=(const Array<T, Bounds> & rhs)
 {
 	//If object addresses are not the same
 	if (this != &rhs)
 	{
-		delete[] m_array;
+		//If lhs array is too small, give it length of rhs array
+		if (rhs.m_length > m_capacity)
+		{
+			T * newArray = new T[rhs.m_length];
+
+			delete[] m_array;
+			m_array = newArray;
+			m_capacity = rhs.m_length;
+		}
+
+		CopyElements(m_array, rhs.m_array, rhs.m_length);
+
 		m_length = rhs.m_length;
 		m_start_index = rhs.m_start_index;
+	}
 
-		//If lenth is zero
-		if (rhs.m_length == 0)
-		{
-			m_array = nullptr;
-		}
-		//Else lhs array is given length of rhs array
-		else
-		{
-			m_array = new T[rhs.m_length];
+	return *this;
+}
 
-			for (int i = 0; i < m_length; i++)
-				m_array[i] = rhs.m_array[i];
-		}
+/**********************************************************************
+* Purpose:
+*	To free this Array's data and take over the dynamic array of an
+*	existing Array object instead of copying it.
+*
+* Precondition:
+*	An existing Array object that is about to be discarded.
+*
+* Postcondition:
+*	This Array holds the data of the other Array, and the other Array
+*	is empty with length zero.
+**********************************************************************/
+template <typename T, typename Bounds>
+Array<T, Bounds> & Array<T, Bounds>::operator=(Array<T, Bounds> && rhs) noexcept
+{
+	//If object addresses are not the same
+	if (this != &rhs)
+	{
+		delete[] m_array;
+
+		m_array = rhs.m_array;
+		m_length = rhs.m_length;
+		m_capacity = rhs.m_capacity;
+		m_start_index = rhs.m_start_index;
+
+		//Leave rhs empty so its Dtor does not free the data
+		rhs.m_array = nullptr;
+		rhs.m_length = 0;
+		rhs.m_capacity = 0;
+		rhs.m_start_index = 0;
 	}
 
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two Arrays by swapping their pointers,
+*	lengths, capacities, and starting indices. No elements are copied.
+*
+* Precondition:
+*	An existing Array object passed by ref.
+*
+* Postcondition:
+*	Each Array holds the data the other one held.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::Swap(Array<T, Bounds> & other) noexcept
+{
+	T * tempArray = m_array;
+	m_array = other.m_array;
+	other.m_array = tempArray;
+
+	int tempLength = m_length;
+	m_length = other.m_length;
+	other.m_length = tempLength;
+
+	int tempCapacity = m_capacity;
+	m_capacity = other.m_capacity;
+	other.m_capacity = tempCapacity;
+
+	int tempStartIndex = m_start_index;
+	m_start_index = other.m_start_index;
+	other.m_start_index = tempStartIndex;
+}
+
 /**********************************************************************
 * Purpose:
 *	To overload the [] operator in order to behave correctly with
@@ -230,24 +407,38 @@ Array<T> & Array<T>::operator=(const Array<T> & rhs)
 *	The element of the Array the the desired index location is
 *	returned.
 **********************************************************************/
-template <typename T>
-T & Array<T>::operator[](int index) const
+template <typename T, typename Bounds>
+T & Array<T, Bounds>::operator[](int index) const
 {
-	//If accessing element smaller than first element
-	if (index < m_start_index)
-	{
-		//Out of bounds of array
-		throw Exception("ERROR: Index smaller than lower bound.");
-	}
-	//Else if accessing element larger than last element
-	else if (index >= m_length + m_start_index)
-	{
-		//Out of bound of array
-		throw Exception("ERROR: Index larger than upper bound.");
-	}
-	//Else return the real index of array
-	else
-		return m_array[index - m_start_index];
+	//Check for accessing element smaller than first element or larger than last element
+	Bounds::Check(index >= m_start_index, "ERROR: Index smaller than lower bound.");
+	Bounds::Check(index < m_length + m_start_index, "ERROR: Index larger than upper bound.");
+
+	//Return the real index of array
+	return m_array[index - m_start_index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an element of the Array, always checking that the index
+*	is in range whatever the Bounds policy is.
+*
+* Precondition:
+*	An integer representing the desired index.
+*
+* Postcondition:
+*	The element of the Array at the desired index location is
+*	returned, if the index is in range; else, an exception is thrown.
+**********************************************************************/
+template <typename T, typename Bounds>
+T & Array<T, Bounds>::at(int index) const
+{
+	//Check for accessing element smaller than first element or larger than last element
+	CheckedBounds::Check(index >= m_start_index, "ERROR: Index smaller than lower bound.");
+	CheckedBounds::Check(index < m_length + m_start_index, "ERROR: Index larger than upper bound.");
+
+	//Return the real index of array
+	return m_array[index - m_start_index];
 }
 
 /**********************************************************************
@@ -260,8 +451,8 @@ T & Array<T>::operator[](int index) const
 * Postcondition:
 *	The value of the starting index is returned.
 **********************************************************************/
-template <typename T>
-int Array<T>::getStartIndex() const
+template <typename T, typename Bounds>
+int Array<T, Bounds>::getStartIndex() const
 {
 	return m_start_index;
 }
@@ -276,8 +467,8 @@ int Array<T>::getStartIndex() const
 * Postcondition:
 *	The value of the starting index is set to the parameter value.
 **********************************************************************/
-template <typename T>
-void Array<T>::setStartIndex(int start_index)
+template <typename T, typename Bounds>
+void Array<T, Bounds>::setStartIndex(int start_index)
 {
 	m_start_index = start_index;
 }
@@ -292,8 +483,8 @@ void Array<T>::setStartIndex(int start_index)
 * Postcondition:
 *	The value of the length is returned.
 **********************************************************************/
-template <typename T>
-int Array<T>::getLength() const
+template <typename T, typename Bounds>
+int Array<T, Bounds>::getLength() const
 {
 	return m_length;
 }
@@ -307,46 +498,201 @@ int Array<T>::getLength() const
 *	An integer representing the desired length.
 *
 * Postcondition:
-*	The value of the starting index is set to the parameter value and
-*	the pointer to the dynamic array of data is adjusted based on the
-*	new parameter length, only if the parameter is non-negative; else,
-*	an error is displayed.
+*	The value of the length is set to the parameter value (see
+*	resize()), only if the parameter is non-negative; else, an
+*	exception is thrown.
 **********************************************************************/
-template <typename T>
-void Array<T>::setLength(int length)
+template <typename T, typename Bounds>
+void Array<T, Bounds>::setLength(int length)
 {
-	//If length is greater than zero
-	if (length > 0)
-	{
-		T * newArray = new T[length];	//Give new array the new length
-		int smallestLength = 0;			//Will store length of shortest array
+	resize(length);
+}
+
+/**********************************************************************
+* Purpose:
+*	To retrieve the number of elements the dynamic array has room for.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The value of the capacity is returned.
+**********************************************************************/
+template <typename T, typename Bounds>
+int Array<T, Bounds>::getCapacity() const
+{
+	return m_capacity;
+}
 
-										//If original array has shorter length
-		if (m_length < length)
-			smallestLength = m_length;
+/**********************************************************************
+* Purpose:
+*	To make room for at least the given number of elements, so that
+*	growing the Array up to that length does not reallocate. The
+*	length and the elements are unchanged.
+*
+* Precondition:
+*	An integer representing the desired capacity.
+*
+* Postcondition:
+*	The capacity is at least the parameter value, only if the
+*	parameter is non-negative; else, an exception is thrown.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::reserve(int capacity)
+{
+	if (capacity < 0)
+		throw Exception("ERROR: Array of negative length not allowed.");
 
-		//Else new array will have shorter length
-		else
-			smallestLength = length;
+	//Only reallocate if current dynamic array is too small
+	if (capacity > m_capacity)
+	{
+		T * newArray = new T[capacity];	//Give new array the new capacity
 
-		//Assign contents of original array to new array
-		for (int i = 0; i < smallestLength; i++)
-			newArray[i] = m_array[i];
+		//Move contents of original array to new array
+		MoveElements(newArray, m_array, m_length);
 
 		delete[] m_array;
 		m_array = newArray;
-		m_length = length;
+		m_capacity = capacity;
 	}
-	//Else length is zero
-	else if (length == 0)
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the length of the Array. Shrinking keeps the dynamic
+*	array for later growth; growing past the capacity at least doubles
+*	it, so a series of resizes reallocates only a few times.
+*
+* Precondition:
+*	An integer representing the desired length.
+*
+* Postcondition:
+*	The length is set to the parameter value and elements past the old
+*	length are default values, only if the parameter is non-negative;
+*	else, an exception is thrown.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::resize(int length)
+{
+	if (length < 0)
+		throw Exception("ERROR: Array of negative length not allowed.");
+
+	//If longer than capacity, grow geometrically
+	if (length > m_capacity)
+		reserve((length > 2 * m_capacity) ? length : 2 * m_capacity);
+
+	//Give elements past old length default values
+	for (int i = m_length; i < length; i++)
+		m_array[i] = T();
+
+	m_length = length;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add an element after the last element of the Array. When the
+*	capacity runs out it is doubled, so adding n elements one at a
+*	time reallocates only about log2(n) times.
+*
+* Precondition:
+*	A template type of the data to add to the Array.
+*
+* Postcondition:
+*	The data is the last element and the length is one greater.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::push_back(const T & data)
+{
+	if (m_length == m_capacity)
 	{
-		delete[] m_array;
-		m_array = nullptr;
-		m_length = length;
+		T copy = data;	//Data may be an element of this Array, so copy it before reallocating
+
+		reserve((m_capacity == 0) ? ARRAY_MIN_CAPACITY : 2 * m_capacity);
+		m_array[m_length++] = std::move(copy);
 	}
-	//Else length cannot be negative
 	else
-		throw Exception("ERROR: Array of negative length not allowed.");
+		m_array[m_length++] = data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To copy elements from one dynamic array to another, choosing
+*	memcpy for trivially copyable types at compile time.
+*
+* Precondition:
+*	Destination and source arrays with at least count elements.
+*
+* Postcondition:
+*	The first count elements of destination equal those of source.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::CopyElements(T * destination, const T * source, int count)
+{
+	CopyElements(destination, source, count, typename std::is_trivially_copyable<T>::type());
+}
+
+template <typename T, typename Bounds>
+void Array<T, Bounds>::CopyElements(T * destination, const T * source, int count, std::true_type)
+{
+	if (count > 0)
+		std::memcpy(destination, source, count * sizeof(T));
+}
+
+template <typename T, typename Bounds>
+void Array<T, Bounds>::CopyElements(T * destination, const T * source, int count, std::false_type)
+{
+	for (int i = 0; i < count; i++)
+		destination[i] = source[i];
+}
+
+/**********************************************************************
+* Purpose:
+*	To move elements from an old dynamic array into a new one, choosing
+*	memcpy for trivially copyable types at compile time.
+*
+* Precondition:
+*	Destination and source arrays with at least count elements. The
+*	source is about to be freed.
+*
+* Postcondition:
+*	The first count elements of destination hold the elements of
+*	source.
+**********************************************************************/
+template <typename T, typename Bounds>
+void Array<T, Bounds>::MoveElements(T * destination, T * source, int count)
+{
+	MoveElements(destination, source, count, typename std::is_trivially_copyable<T>::type());
+}
+
+template <typename T, typename Bounds>
+void Array<T, Bounds>::MoveElements(T * destination, T * source, int count, std::true_type)
+{
+	if (count > 0)
+		std::memcpy(destination, source, count * sizeof(T));
+}
+
+template <typename T, typename Bounds>
+void Array<T, Bounds>::MoveElements(T * destination, T * source, int count, std::false_type)
+{
+	for (int i = 0; i < count; i++)
+		destination[i] = std::move(source[i]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two Arrays (found by argument-dependent
+*	lookup, so generic code that calls swap uses Array::Swap).
+*
+* Precondition:
+*	Two existing Array objects passed by ref.
+*
+* Postcondition:
+*	Each Array holds the data the other one held.
+**********************************************************************/
+template <typename T, typename Bounds>
+void swap(Array<T, Bounds> & lhs, Array<T, Bounds> & rhs) noexcept
+{
+	lhs.Swap(rhs);
 }
 
 #endif //ARRAY_H
\ No newline at end of file
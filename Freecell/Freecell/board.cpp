@@ -8,7 +8,6 @@
 #include "board.h"
 
 #include <windows.h>
-#include <cmath>
 #include <iostream>
 using std::cout;
 #include <iomanip>
@@ -32,117 +31,92 @@ HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
 **********************************************************************/
 Board::Board()
 {
-	CreateBoard();
+	//Create deck and shuffle the cards
+	Deck tempDeck;
+	tempDeck.Shuffle();
 
-	//All free cells start as empty
-	for (int i = 0; i < NUM_FREE_CELLS; i++)
-		m_emptyFreeCell[i] = true;
+	CreateBoard(tempDeck);	//Also sets all free cells to empty
 }
 
 /**********************************************************************
 * Purpose:
-*	To construct an instance of an Board with data members whose
-*	initial values are copied from data members of an existing Board
-*	object.
+*	To construct an instance of a Board in which the cards are
+*	distributed in the order of an existing deck.
 *
 * Precondition:
-*	An existing Board object passed by const ref.
+*	An existing Deck object passed by const ref.
 *
 * Postcondition:
-*	The data members are initialized to the values of the data members
-*	of the existing Board object.
+*	Data members are initialized and the cards of the deck are
+*	distributed to the play area.
 **********************************************************************/
-Board::Board(const Board & copy) : m_freeCells(copy.m_freeCells), m_homeCells(copy.m_homeCells), m_playArea(copy.m_playArea)
+Board::Board(const Deck & deck)
 {
-	*this = copy;	//Use assignment operator
+	Deck tempDeck(deck);	//Copy so dealing does not change the caller's deck
+
+	CreateBoard(tempDeck);	//Also sets all free cells to empty
 }
 
 /**********************************************************************
 * Purpose:
-*	To destroy the Board object and reset the data members to default
-*	values.
+*	To construct an instance of a Board with the classic numbered deal
+*	of the given game number.
 *
 * Precondition:
-*	<None>
+*	A game number.
 *
 * Postcondition:
-*	Data members are reset to default values.
+*	Data members are initialized and the cards of the numbered deal
+*	are distributed to the play area.
 **********************************************************************/
-Board::~Board()
+Board::Board(unsigned int gameNumber)
 {
-	m_freeCells.setLength(0);	//clear original data from free cells
-	m_homeCells.setLength(0);	//clear original data from home cells
-	m_playArea.setLength(0);	//clear original data from play area cells
+	Deck tempDeck;
+	tempDeck.DealGameNumber(gameNumber);
 
-	//Reset to default values
-	for (int i = 0; i < NUM_FREE_CELLS; i++)
-		m_emptyFreeCell[i] = true;
+	CreateBoard(tempDeck);	//Also sets all free cells to empty
 }
 
 /**********************************************************************
 * Purpose:
-*	To assign one existing Board object to another existing Board
-*	object by copying values of data members from one to another.
+*	To construct an instance of a Board with no cards, without dealing
+*	one first, so a position can be set up card by card.
 *
 * Precondition:
-*	An existing Board object passed by const ref.
+*	<None>
 *
 * Postcondition:
-*	One existing Board object is assigned to another existing Board
-*	object.
+*	The board has no cards.
 **********************************************************************/
-Board & Board::operator=(const Board & rhs)
+Board::Board(EmptyBoardTag)
 {
-	//Check for self-assignment
-	if (this != &rhs)
-	{
-		//Use Array's assignment operator
-		m_freeCells = rhs.m_freeCells;
-		m_homeCells = rhs.m_homeCells;
-		m_playArea = rhs.m_playArea;
-
-		for (int i = 0; i < NUM_FREE_CELLS; i++)
-			m_emptyFreeCell[i] = rhs.m_emptyFreeCell[i];
-	}
-
-	return *this;
+	ClearBoard();
 }
 
 /**********************************************************************
 * Purpose:
-*	To distribute shuffled cards to the play area on board, and give
-*	the free cell area empty card cells and the home cell area empty
-*	stacks for future cards.
+*	To distribute the cards of a deck to the play area on board, and
+*	give the free cell area empty card cells and the home cell area
+*	empty stacks for future cards.
 *
 * Precondition:
-*	The areas on the board have no cards and no size to hold cards.
+*	A Deck object whose cards have not been dealt yet.
 *
 * Postcondition:
 *	All cards are distributed on the play area, and the free cell and
 *	home cell areas have no cards.
 **********************************************************************/
-void Board::CreateBoard()
+void Board::CreateBoard(Deck & deck)
 {
-	m_freeCells.setLength(NUM_FREE_CELLS);	//4 free cells
-	m_homeCells.setLength(NUM_HOME_CELLS);	//4 home cells
-	m_playArea.setLength(NUM_PLAY_CELLS);	//8 play cells
-
-	//Assign each home cell a stack of 13 cards
-	for (int i = 0; i < NUM_HOME_CELLS; i++)
-	{
-		m_homeCells[i] = StackArray<Card>(NUM_RANKS);
-	}
-
-	//Create deck and shuffle the cards
-	Deck tempDeck;
-	tempDeck.Shuffle();
+	//Empty every area and reset the hashes and counters
+	ClearBoard();
 
 	//Distribute cards to play area
 	for (int i = 0; i < NUM_CARDS_DECK;)
 	{
 		for (int j = 0; j < NUM_PLAY_CELLS && i < NUM_CARDS_DECK; j++)
 		{
-			m_playArea[j].Push(tempDeck.Deal());	//Deal card to play area
+			PushColumn(j, deck.Deal());	//Deal card to play area
 			i++;	//Increment number of cards dealt to play area
 		}
 	}
@@ -162,123 +136,16 @@ void Board::CreateBoard()
 **********************************************************************/
 void Board::MovePlayToPlay(int column1, int column2, int numCards)
 {
-	StackArray<Card> tempStack(numCards);	//Holds cards being moved
-	Card tempCard;		//Holds one card to compare with another
-	int numMovedCards = 0;		//Counts number of cards being moved
-
-	//Check number of cards allowed to be moved
-	if (numCards > CalculateMaxMovableCards(column2))
-		throw Exception("ERROR: Not enough open cells to move that many cards.");
-
-	//If not moving from an empty play area column
-	if (!m_playArea[column1].isEmpty())
-	{
-		//***Move card(s) from column
-
-		//Remove and save the first card from play area column & increment count of moved cards
-		tempCard = m_playArea[column1].Pop();
-		tempStack.Push(tempCard);
-		numMovedCards++;
-
-		//Attempt to move more cards
-		for (int i = 0; i < numCards - 1; i++)
-		{
-			//If moving from an empty play area column
-			if (m_playArea[column1].isEmpty())
-			{
-				//Restore original column
-				for (int i = 0; i < numMovedCards; i++)
-				{
-					m_playArea[column1].Push(tempStack.Pop());
-				}
-				throw Exception("ERROR: Cannot move more cards than are available.");
-			}
-
-			//If ranks are in order (previously removed card is one less than next card to be removed) 
-			if (m_playArea[column1].Peek().GetRank() - tempCard.GetRank() == 1)	
-			{
-				//If suit colors are opposite (+-1 & +-3 specify the opposite colored suits by enum value)
-				if (tempCard.GetSuit() + 1 == m_playArea[column1].Peek().GetSuit() ||
-					tempCard.GetSuit() + 3 == m_playArea[column1].Peek().GetSuit() ||
-					tempCard.GetSuit() - 1 == m_playArea[column1].Peek().GetSuit() ||
-					tempCard.GetSuit() - 3 == m_playArea[column1].Peek().GetSuit())
-				{
-					//Remove and save the next card from play area column & increment count of moved cards
-					tempCard = m_playArea[column1].Pop();
-					tempStack.Push(tempCard);
-					numMovedCards++;
-				}
-				else
-				{
-					//Restore original column
-					for (int i = 0; i < numMovedCards; i++)
-					{
-						m_playArea[column1].Push(tempStack.Pop());
-					}
-					throw Exception("ERROR: Not all cards to be moved are in the correct order.");
-				}
-			}
-			else
-			{
-				//Restore original column
-				for (int i = 0; i < numMovedCards; i++)
-				{
-					m_playArea[column1].Push(tempStack.Pop());
-				}
-				throw Exception("ERROR: Not all cards to be moved are in the correct order.");
-			}
-		}
-	}
-	else
-		throw Exception("ERROR: Cannot move from an empty play area column.");
+	MoveStatus status = CanMovePlayToPlay(column1, column2, numCards);	//Whether the move is allowed
 
-	//***Move card(s) to column
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
 
-	//If column to move card(s) to is empty
-	if (m_playArea[column2].isEmpty())
-	{
-		//Add each moved card to the play area column
-		for (int i = 0; i < numMovedCards; i++)
-		{
-			m_playArea[column2].Push(tempStack.Pop());
-		}
-	}
-	//Else if ranks are in order (first card to be added is one less than current top card of column) 
-	else if (m_playArea[column2].Peek().GetRank() - tempStack.Peek().GetRank() == 1)			
-	{
-		//If suit colors are opposite (+-1 & +-3 specify the opposite colored suits by enum value)
-		if (tempStack.Peek().GetSuit() + 1 == m_playArea[column2].Peek().GetSuit() ||
-			tempStack.Peek().GetSuit() + 3 == m_playArea[column2].Peek().GetSuit() ||
-			tempStack.Peek().GetSuit() - 1 == m_playArea[column2].Peek().GetSuit() ||
-			tempStack.Peek().GetSuit() - 3 == m_playArea[column2].Peek().GetSuit())
-		{
-			//Add each moved card to the play area column
-			for (int i = 0; i < numMovedCards; i++)
-			{
-				m_playArea[column2].Push(tempStack.Pop());
-			}
-		}
-		else
-		{
-			//Restore original column
-			for (int i = 0; i < numMovedCards; i++)
-			{
-				m_playArea[column1].Push(tempStack.Pop());
-			}
-			throw Exception("ERROR: Cannot move card(s) to that location. Invalid combination of cards.");
-		}
-	}
-	else
-	{
-		//Restore original column
-		for (int i = 0; i < numMovedCards; i++)
-		{
-			m_playArea[column1].Push(tempStack.Pop());
-		}
-		throw Exception("ERROR: Cannot move card(s) to that location. Invalid combination of cards.");
-	}	
+	//Move the run to the other column as one block
+	TransferRun(column1, column2, numCards);
 }
 
+
 /**********************************************************************
 * Purpose:
 *	To move the card(s) from a play area column to a free cell.
@@ -292,24 +159,16 @@ void Board::MovePlayToPlay(int column1, int column2, int numCards)
 **********************************************************************/
 void Board::MovePlayToFree(int column, int freeCellIndex)
 {
-	//If not moving from an empty play area column
-	if (!m_playArea[column].isEmpty())
-	{
-		//If desired free cell index is empty
-		if (m_emptyFreeCell[freeCellIndex] == true)
-		{
-			//Remove card from play area and place in free cell
-			m_freeCells[freeCellIndex] = m_playArea[column].Pop();
-			//Set free cell to non-empty
-			m_emptyFreeCell[freeCellIndex] = false;
-		}
-		else
-			throw Exception("ERROR: Cannot put card in a filled free cell.");
-	}
-	else
-		throw Exception("ERROR: Cannot move from an empty play area column.");
+	MoveStatus status = CanMovePlayToFree(column, freeCellIndex);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	//Remove card from play area and place in free cell (sets free cell to non-empty)
+	FillFreeCell(freeCellIndex, PopColumn(column));
 }
 
+
 /**********************************************************************
 * Purpose:
 *	To move the card(s) from a play area column to a home cell.
@@ -323,37 +182,16 @@ void Board::MovePlayToFree(int column, int freeCellIndex)
 **********************************************************************/
 void Board::MovePlayToHome(int column, int homeCellIndex)
 {
-	//If not moving from an empty play area column
-	if (!m_playArea[column].isEmpty())
-	{
-		//If desired home cell is empty
-		if (m_homeCells[homeCellIndex].isEmpty())
-		{
-			//If card to be moved is an ACE, remove from play area and put as first card in desired home cell
-			if (m_playArea[column].Peek().GetRank() == ACE)
-				m_homeCells[homeCellIndex].Push(m_playArea[column].Pop());
-			else
-				throw Exception("ERROR: Cannot place that card as the first one in a home cell.");
-		}
-		else
-		{
-			//If ranks are in order (card to be added is one more than current top card of home cell) 
-			if (m_playArea[column].Peek().GetRank() - m_homeCells[homeCellIndex].Peek().GetRank() == 1)
-			{
-				//If suits are same, remove card from play area and put as next card in desired home cell
-				if (m_playArea[column].Peek().GetSuit() == m_homeCells[homeCellIndex].Peek().GetSuit())
-					m_homeCells[homeCellIndex].Push(m_playArea[column].Pop());
-				else
-					throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-			}
-			else
-				throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-		}
-	}
-	else
-		throw Exception("ERROR: Cannot move from an empty play area column.");
+	MoveStatus status = CanMovePlayToHome(column, homeCellIndex);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	//Remove card from play area and put as next card in desired home cell
+	PushHome(homeCellIndex, PopColumn(column));
 }
 
+
 /**********************************************************************
 * Purpose:
 *	To move the card(s) from a free cell to a play area column.
@@ -368,44 +206,18 @@ void Board::MovePlayToHome(int column, int homeCellIndex)
 **********************************************************************/
 void Board::MoveFreeToPlay(int freeCellIndex, int column)
 {
-	//If not moving from an empty free cell
-	if (m_emptyFreeCell[freeCellIndex] == false)
-	{
-		//If moving to an empty play area column
-		if (m_playArea[column].isEmpty())
-		{
-			//Remove card from free cell and add to column of play area
-			m_playArea[column].Push(m_freeCells[freeCellIndex]);
-			//Set free cell to empty
-			m_emptyFreeCell[freeCellIndex] = true;
-		}
-		else
-		{
-			//If ranks are in order (card to be added is one less than current top card of column)
-			if (m_playArea[column].Peek().GetRank() - m_freeCells[freeCellIndex].GetRank() == 1)
-			{
-				//If suit colors are opposite (+-1 & +-3 specify the opposite colored suits by enum value)
-				if (m_freeCells[freeCellIndex].GetSuit() + 1 == m_playArea[column].Peek().GetSuit() ||
-					m_freeCells[freeCellIndex].GetSuit() + 3 == m_playArea[column].Peek().GetSuit() ||
-					m_freeCells[freeCellIndex].GetSuit() - 1 == m_playArea[column].Peek().GetSuit() ||
-					m_freeCells[freeCellIndex].GetSuit() - 3 == m_playArea[column].Peek().GetSuit())
-				{
-					//Remove card from free cell and add as next card in play area column
-					m_playArea[column].Push(m_freeCells[freeCellIndex]);
-					//Set free cell to empty
-					m_emptyFreeCell[freeCellIndex] = true;
-				}
-				else
-					throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-			}
-			else
-				throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-		}
-	}
-	else
-		throw Exception("ERROR: Cannot move from an empty free cell.");
+	MoveStatus status = CanMoveFreeToPlay(freeCellIndex, column);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	//Remove card from free cell and add as next card in play area column
+	PushColumn(column, m_freeCells[freeCellIndex]);
+	//Set free cell to empty
+	ClearFreeCell(freeCellIndex);
 }
 
+
 /**********************************************************************
 * Purpose:
 *	To move the card(s) from a free cell to a home cell.
@@ -419,85 +231,184 @@ void Board::MoveFreeToPlay(int freeCellIndex, int column)
 **********************************************************************/
 void Board::MoveFreeToHome(int freeCellIndex, int homeCellIndex)
 {
-	//If not moving from an empty free cell
-	if (m_emptyFreeCell[freeCellIndex] == false)
-	{
-		//If desired home cell is empty
-		if (m_homeCells[homeCellIndex].isEmpty())
-		{
-			//If card to be moved is an ACE
-			if (m_freeCells[freeCellIndex].GetRank() == ACE)
-			{
-				//Remove card from free cell and put as first card in desired home cell
-				m_homeCells[homeCellIndex].Push(m_freeCells[freeCellIndex]);
-				//Set free cell to empty
-				m_emptyFreeCell[freeCellIndex] = true;
-			}
-			else
-				throw Exception("ERROR: Cannot place that card as the first one in a home cell.");
-		}
-		else
-		{
-			//If ranks are in order (card to be added is one more than current top card in home cell)
-			if (m_freeCells[freeCellIndex].GetRank() - m_homeCells[homeCellIndex].Peek().GetRank() == 1)
-			{
-				//If suits are the same
-				if (m_freeCells[freeCellIndex].GetSuit() == m_homeCells[homeCellIndex].Peek().GetSuit())
-				{
-					//Remove card from free cell and put as next card in desired home cell
-					m_homeCells[homeCellIndex].Push(m_freeCells[freeCellIndex]);
-					//Set free cell to empty
-					m_emptyFreeCell[freeCellIndex] = true;
-				}
-				else
-					throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-			}
-			else
-				throw Exception("ERROR: Cannot move card to that location. Invalid combination of cards.");
-		}
-	}
-	else
-		throw Exception("ERROR: Cannot move from an empty free cell.");
+	MoveStatus status = CanMoveFreeToHome(freeCellIndex, homeCellIndex);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	//Remove card from free cell and put as next card in desired home cell
+	PushHome(homeCellIndex, m_freeCells[freeCellIndex]);
+	//Set free cell to empty
+	ClearFreeCell(freeCellIndex);
 }
 
+
 /**********************************************************************
 * Purpose:
-*	To calculate maximum number of cards that can be moved from play
-*	area to play area at one time.
+*	To check whether card(s) may be moved from a play area column to a
+*	different play area column, without changing the board. The rule
+*	is CheckPlayToPlay() of move.h, given the run on top of the column
+*	from the run lengths the board keeps.
 *
 * Precondition:
-*	Called from the MovePlayToPlay() board method.
+*	Three integers specifying the index of the column to move from,
+*	the index of the column to move to, and the number of cards to move.
 *
 * Postcondition:
-*	The maximum number of cards allowed to be moved is returned.
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
 **********************************************************************/
-int Board::CalculateMaxMovableCards(int destColumn)
+MoveStatus Board::CanMovePlayToPlay(int column1, int column2, int numCards) const
 {
-	int numEmptyFreeCells = 0;	//Counts number of free cells that are empty
-	int numEmptyPlayCells = 0;	//Counts number of play area columns that are empty
+	int size = m_playArea[column1].Size();		//Cards in the column to move from
+	int runLength = GetRunLength(column1);		//Cards on top of the column that are in order
+	Card runBottom = (numCards > 0 && numCards <= runLength) ? m_playArea[column1][size - numCards]
+		: Card(NO_CARD_CODE);					//Bottom card to move, if the run holds it
 
-	//Check each free cell
-	for (int i = 0; i < NUM_FREE_CELLS; i++)
-	{
-		//If empty, increment count of number of empty free cells
-		if (m_emptyFreeCell[i] == true)
-			numEmptyFreeCells++;
-	}
+	return CheckPlayToPlay(column1, column2, numCards, CalculateMaxMovableCards(column2), size, runLength,
+		runBottom, ColumnTopOrNone(column2));
+}
 
-	//Check each play area column
-	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a play area column to a
+*	free cell, without changing the board.
+*
+* Precondition:
+*	Two integers specifying the index of the column to move from and
+*	the index of the free cell to move to.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus Board::CanMovePlayToFree(int column, int freeCellIndex) const
+{
+	return CheckPlayToFree(ColumnTopOrNone(column), FreeCellOrNone(freeCellIndex));
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a play area column to a
+*	home cell, without changing the board.
+*
+* Precondition:
+*	Two integers specifying the index of the column to move from and
+*	the index of the home cell to move to.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus Board::CanMovePlayToHome(int column, int homeCellIndex) const
+{
+	return CheckPlayToHome(ColumnTopOrNone(column), HomeCellTopOrNone(homeCellIndex));
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a free cell to a play
+*	area column, without changing the board.
+*
+* Precondition:
+*	Two integers specifying the index of the free cell to move from,
+*	and the index of the play area column to move to.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus Board::CanMoveFreeToPlay(int freeCellIndex, int column) const
+{
+	return CheckFreeToPlay(FreeCellOrNone(freeCellIndex), ColumnTopOrNone(column));
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a free cell to a home
+*	cell, without changing the board.
+*
+* Precondition:
+*	Two integers specifying the index of the free cell to move from,
+*	and the index of the home cell to move to.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus Board::CanMoveFreeToHome(int freeCellIndex, int homeCellIndex) const
+{
+	return CheckFreeToHome(FreeCellOrNone(freeCellIndex), HomeCellTopOrNone(homeCellIndex));
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a move may be made, with the CanMove* method of
+*	its kind.
+*
+* Precondition:
+*	An existing Move object passed by const ref.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus Board::CanMove(const Move & move) const
+{
+	switch (move.GetType())
 	{
-		//If empty, increment count of number of empty play area columns
-		if (m_playArea[i].isEmpty())
-			numEmptyPlayCells++;
+		case PLAY_TO_HOME:
+			return CanMovePlayToHome(move.GetFrom(), move.GetTo());
+		case FREE_TO_HOME:
+			return CanMoveFreeToHome(move.GetFrom(), move.GetTo());
+		case FREE_TO_PLAY:
+			return CanMoveFreeToPlay(move.GetFrom(), move.GetTo());
+		case PLAY_TO_PLAY:
+			return CanMovePlayToPlay(move.GetFrom(), move.GetTo(), move.GetCount());
+		case PLAY_TO_FREE:
+			return CanMovePlayToFree(move.GetFrom(), move.GetTo());
 	}
 
-	//If play area column to move card(s) to is empty, decrement count of number of empty play area columns
+	return MOVE_OK;
+}
+
+/**********************************************************************
+* Purpose:
+*	To make a move if it is allowed, without throwing. A rejected move
+*	leaves the board unchanged and costs only the check.
+*
+* Precondition:
+*	An existing Move object passed by const ref.
+*
+* Postcondition:
+*	The card(s) are moved and MOVE_OK is returned, or the board is
+*	unchanged and the reason the move is not allowed is returned.
+**********************************************************************/
+MoveStatus Board::TryMove(const Move & move)
+{
+	MoveStatus status = CanMove(move);	//Whether the move is allowed
+
+	if (status == MOVE_OK)
+		MakeMove(move);
+
+	return status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To calculate maximum number of cards that can be moved from play
+*	area to play area at one time. The moves keep count of the empty
+*	free cells and columns, so no cells are scanned.
+*
+* Precondition:
+*	Called from the CanMovePlayToPlay() and GenerateMoves() board methods.
+*
+* Postcondition:
+*	The maximum number of cards allowed to be moved is returned.
+**********************************************************************/
+int Board::CalculateMaxMovableCards(int destColumn) const
+{
+	int numEmptyPlayCells = m_numEmptyColumns;	//Empty columns that can hold part of the run
+
+	//If play area column to move card(s) to is empty, it cannot also hold part of the run
 	if (m_playArea[destColumn].isEmpty())
 		numEmptyPlayCells--;
 
-	//Return calculated max number of cards to be moved
-	return ((1 + numEmptyFreeCells) * pow(2, numEmptyPlayCells));
+	return MaxMovableCards(m_numEmptyFreeCells, numEmptyPlayCells);
 }
 
 /**********************************************************************
@@ -515,9 +426,6 @@ void Board::DisplayBoard()
 {
 	system("cls");	//Clear screen
 
-	bool emptyPlayCell[NUM_PLAY_CELLS] = { false };		//Flags whether each play area column is empty
-	bool noMorePlayCells = false;		//Flags whether all play area columns are empty
-
 	//***Display Free Cell Area
 
 	//For each free cell
@@ -575,66 +483,30 @@ void Board::DisplayBoard()
 
 	//***Display Play Area
 
-	Array<StackLL<Card>> playAreaCopy(m_playArea);	//Copy of current play area that can be changed
-	Array<StackLL<Card>> tempPlayArea;		//To hold cards in opposite order
-	tempPlayArea.setLength(NUM_PLAY_CELLS);		//8 play cells
+	int numRows = 0;	//Number of cards in the longest play area column
 
-	//Reverse order of cards in each stack of the play area
-	while (noMorePlayCells == false)		//Loop through each row of play cells
+	//Find the longest column
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
 	{
-		noMorePlayCells = true;
-
-		for (int i = 0; i < NUM_PLAY_CELLS; i++)	//Loop through each column of play cells
-		{
-			//Remove and store top card if given column is not empty
-			if (!playAreaCopy[i].isEmpty())
-				tempPlayArea[i].Push(playAreaCopy[i].Pop());
-			else
-				emptyPlayCell[i] = true;	//Mark given column as empty
-		}
-
-		//Check if all columns are empty
-		for (int i = 0; i < NUM_PLAY_CELLS; i++)
-		{
-			//If any not empty, keep looping and reversing order of cards
-			if (emptyPlayCell[i] == false)
-				noMorePlayCells = false;
-		}
+		if (m_playArea[i].Size() > numRows)
+			numRows = m_playArea[i].Size();
 	}
-	
-	//Reset all flags to false
-	for (int i = 0; i < NUM_PLAY_CELLS; i++)
-		emptyPlayCell[i] = false;
-
-	noMorePlayCells = false;
 
-	//Display each card of the play area
-	while (noMorePlayCells == false)		//Loop through each row of play cells
+	//Display each card of the play area, bottom of each column first, followed by a blank row
+	for (int row = 0; row <= numRows; row++)		//Loop through each row of play cells
 	{
-		noMorePlayCells = true;
 		cout << "\n     ";		//Move down a line and indent 5 spaces from edge
 
 		for (int i = 0; i < NUM_PLAY_CELLS; i++)	//Loop through each column of play cells
 		{
-			//Remove and display top card if given column not empty
-			if (!tempPlayArea[i].isEmpty())
+			//Display card if given column reaches this row
+			if (row < m_playArea[i].Size())
 			{
 				cout << " ";
-				DisplaySingleCard(tempPlayArea[i].Pop());
+				DisplaySingleCard(m_playArea[i][row]);
 			}
 			else
-			{
 				cout << "     ";		//Display empty space
-				emptyPlayCell[i] = true;	//Mark given column as empty
-			}
-		}
-
-		//Check if all columns are empty
-		for (int i = 0; i < NUM_PLAY_CELLS; i++)
-		{
-			//If not empty, keep looping and displaying
-			if (emptyPlayCell[i] == false)
-				noMorePlayCells = false;
 		}
 	}
 
@@ -675,7 +547,7 @@ void Board::DisplaySingleCard(const Card & card)
 	char suit = ConvertSuit(card);		//Suit character to be displayed
 
 	//If card is a red suit
-	if (card.GetSuit() == HEART || card.GetSuit() == DIAMOND)
+	if (card.GetColor() == RED)
 	{
 		SetConsoleTextAttribute(handle, 124);	//Red text on gray background
 		cout << setw(2) << rank << " " << suit;	//Display rank and suit
@@ -763,24 +635,10 @@ char Board::ConvertSuit(const Card & card)
 * Postcondition:
 *	A bool specifying whether the user won the game is returned.
 **********************************************************************/
-bool Board::WonGame()
+bool Board::WonGame() const
 {
-	bool wonGame = false;		//Flags whether user won game
-	int numFullHomeCells = 0;	//Counts number of home cells that are full
-
-	//Check if each home cell is full
-	for (int i = 0; i < NUM_HOME_CELLS; i++)
-	{
-		//If home cell is full, increment count of home cells that are full
-		if (m_homeCells[i].isFull())
-			numFullHomeCells++;		
-	}
-
-	//If all home cells are full, user won game
-	if (numFullHomeCells == NUM_HOME_CELLS)
-		wonGame = true;
-
-	return wonGame;
+	//User won game once every card is in a home cell
+	return (m_numHomeCards == NUM_CARDS_DECK);
 }
 
 /**********************************************************************
@@ -798,13 +656,811 @@ bool Board::WonGame()
 **********************************************************************/
 void Board::ResetNewBoard()
 {
-	m_freeCells.setLength(0);	//clear original data from free cells
-	m_homeCells.setLength(0);	//clear original data from home cells
-	m_playArea.setLength(0);	//clear original data from play area cells
+	//Create deck and shuffle the cards
+	Deck tempDeck;
+	tempDeck.Shuffle();
 
-	//Reset all free cells to empty
+	CreateBoard(tempDeck);		//Re-create the board
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove every card from the free cells, home cells, and play
+*	area, so a position can be set up card by card.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The board has no cards.
+**********************************************************************/
+void Board::ClearBoard()
+{
+	//Empty each free cell
 	for (int i = 0; i < NUM_FREE_CELLS; i++)
 		m_emptyFreeCell[i] = true;
 
-	CreateBoard();		//Re-create the board
-}
\ No newline at end of file
+	//Empty each home cell
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+		m_homeCells[i].Purge();
+
+	//No suit has any cards home
+	for (int i = 0; i < NUM_SUITS; i++)
+		m_homeHeight[i] = 0;
+
+	//Empty each play area column
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		m_playArea[i].Purge();
+		m_columnHash[i] = 0;
+	}
+
+	m_hash = 0;
+	m_canonicalHash = 0;
+	m_numEmptyFreeCells = NUM_FREE_CELLS;
+	m_numEmptyColumns = NUM_PLAY_CELLS;
+	m_numHomeCards = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a card on top of a play area column without checking the
+*	rules, for setting up a position.
+*
+* Precondition:
+*	The index of a play area column and the card to put on it.
+*
+* Postcondition:
+*	The card is the top card of the column.
+**********************************************************************/
+void Board::PlaceInColumn(int column, const Card & card)
+{
+	PushColumn(column, card);
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a card in a free cell without checking the rules, for
+*	setting up a position.
+*
+* Precondition:
+*	The index of an empty free cell and the card to put in it.
+*
+* Postcondition:
+*	The card is in the free cell.
+**********************************************************************/
+void Board::PlaceInFreeCell(int freeCellIndex, const Card & card)
+{
+	if (m_emptyFreeCell[freeCellIndex] == false)
+		throw Exception("ERROR: Cannot put card in a filled free cell.");
+
+	FillFreeCell(freeCellIndex, card);
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a card on top of a home cell without checking the rules,
+*	for setting up a position.
+*
+* Precondition:
+*	The index of a home cell and the card to put on it.
+*
+* Postcondition:
+*	The card is the top card of the home cell.
+**********************************************************************/
+void Board::PlaceInHomeCell(int homeCellIndex, const Card & card)
+{
+	PushHome(homeCellIndex, card);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the 64-bit Zobrist hash of the position. Boards holding
+*	the same cards in the same places always have the same hash.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The hash is returned.
+**********************************************************************/
+unsigned long long Board::GetHash() const
+{
+	return m_hash;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether two boards hold the same cards in the same free
+*	cells, home cells, and play area columns. The hashes are compared
+*	first, so boards that differ are almost always rejected without
+*	looking at any cards.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the positions are identical.
+**********************************************************************/
+bool Board::operator==(const Board & rhs) const
+{
+	if (m_hash != rhs.m_hash)
+		return false;
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (m_emptyFreeCell[i] != rhs.m_emptyFreeCell[i])
+			return false;
+
+		if (!m_emptyFreeCell[i] && m_freeCells[i] != rhs.m_freeCells[i])
+			return false;
+	}
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		if (m_homeCells[i].Size() != rhs.m_homeCells[i].Size())
+			return false;
+
+		if (!m_homeCells[i].isEmpty() && m_homeCells[i].Peek() != rhs.m_homeCells[i].Peek())
+			return false;
+	}
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		if (m_playArea[i].Size() != rhs.m_playArea[i].Size())
+			return false;
+
+		for (int depth = 0; depth < m_playArea[i].Size(); depth++)
+		{
+			if (m_playArea[i][depth] != rhs.m_playArea[i][depth])
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether two boards differ.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the positions are not identical.
+**********************************************************************/
+bool Board::operator!=(const Board & rhs) const
+{
+	return !(*this == rhs);
+}
+
+/**********************************************************************
+* Purpose:
+*	To recompute the Zobrist hash from every card on the board. Moves
+*	keep the hash up to date on their own; this is for checking.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The hash of the current position is returned.
+**********************************************************************/
+unsigned long long Board::ComputeHash() const
+{
+	unsigned long long hash = 0;	//XOR of the keys of every card
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (!m_emptyFreeCell[i])
+			hash ^= FreeCellKey(i, m_freeCells[i]);
+	}
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		for (int depth = 0; depth < m_homeCells[i].Size(); depth++)
+			hash ^= HomeCellKey(i, m_homeCells[i][depth]);
+	}
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		for (int depth = 0; depth < m_playArea[i].Size(); depth++)
+			hash ^= ColumnKey(i, depth, m_playArea[i][depth]);
+	}
+
+	return hash;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the canonical hash of the position. The order of the
+*	play area columns, of the free cells, and of the home cells makes
+*	no difference to the game, so the canonical hash ignores it: boards
+*	that differ only by which column, free cell, or home cell holds
+*	what have the same canonical hash. Search caches keyed on it store
+*	each of the up to 8! * 4! equivalent layouts of a position once.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The canonical hash is returned.
+**********************************************************************/
+unsigned long long Board::GetCanonicalHash() const
+{
+	return m_canonicalHash;
+}
+
+/**********************************************************************
+* Purpose:
+*	To recompute the canonical hash from every card on the board. Moves
+*	keep the hash up to date on their own; this is for checking.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The canonical hash of the current position is returned.
+**********************************************************************/
+unsigned long long Board::ComputeCanonicalHash() const
+{
+	unsigned long long hash = 0;	//Sum of mixed column hashes and cell keys
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (!m_emptyFreeCell[i])
+			hash += CanonicalFreeCellKey(m_freeCells[i]);
+	}
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		for (int depth = 0; depth < m_homeCells[i].Size(); depth++)
+			hash += CanonicalHomeCellKey(m_homeCells[i][depth]);
+	}
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		unsigned long long columnHash = 0;	//Hash of this column's cards alone
+
+		for (int depth = 0; depth < m_playArea[i].Size(); depth++)
+			columnHash ^= CanonicalColumnKey(depth, m_playArea[i][depth]);
+
+		hash += Prng::Mix(columnHash);
+	}
+
+	return hash;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the standard layout of this position: the play area
+*	columns sorted by their cards from the bottom up (empty columns
+*	first), the free cell cards sorted and packed to the left, and the
+*	home cells sorted by suit (empty home cells last). Every equivalent
+*	layout has the same standard layout, which compares equal with ==.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The board in standard layout is returned. This board is unchanged
+*	and has the same canonical hash.
+**********************************************************************/
+Board Board::Canonicalize() const
+{
+	int columnOrder[NUM_PLAY_CELLS];	//Column indices in sorted order
+	int homeOrder[NUM_HOME_CELLS];		//Home cell indices in sorted order
+	Card freeCards[NUM_FREE_CELLS];		//Cards of the non-empty free cells
+	int numFreeCards = 0;				//Number of non-empty free cells
+
+	//Insertion sort the columns (there are only eight)
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		int j = i;
+
+		for (; j > 0 && ColumnPrecedes(i, columnOrder[j - 1]); j--)
+			columnOrder[j] = columnOrder[j - 1];
+
+		columnOrder[j] = i;
+	}
+
+	//Insertion sort the home cells by the code of their bottom card
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		int j = i;
+
+		for (; j > 0 && HomeCellPrecedes(i, homeOrder[j - 1]); j--)
+			homeOrder[j] = homeOrder[j - 1];
+
+		homeOrder[j] = i;
+	}
+
+	//Insertion sort the free cell cards by code
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (!m_emptyFreeCell[i])
+		{
+			int j = numFreeCards++;
+
+			for (; j > 0 && m_freeCells[i].GetCode() < freeCards[j - 1].GetCode(); j--)
+				freeCards[j] = freeCards[j - 1];
+
+			freeCards[j] = m_freeCells[i];
+		}
+	}
+
+	Board canonical(*this);	//Copy, then lay the cards out again
+	canonical.ClearBoard();
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		for (int depth = 0; depth < m_playArea[columnOrder[i]].Size(); depth++)
+			canonical.PushColumn(i, m_playArea[columnOrder[i]][depth]);
+	}
+
+	for (int i = 0; i < numFreeCards; i++)
+		canonical.FillFreeCell(i, freeCards[i]);
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		for (int depth = 0; depth < m_homeCells[homeOrder[i]].Size(); depth++)
+			canonical.PushHome(i, m_homeCells[homeOrder[i]][depth]);
+	}
+
+	return canonical;
+}
+
+/**********************************************************************
+* Purpose:
+*	To order two play area columns for the standard layout, comparing
+*	card codes from the bottom up. A column that runs out first (such
+*	as an empty column) comes first.
+*
+* Precondition:
+*	The indices of two play area columns.
+*
+* Postcondition:
+*	True is returned if column1 comes before column2.
+**********************************************************************/
+bool Board::ColumnPrecedes(int column1, int column2) const
+{
+	const StackFixed<Card, MAX_PLAY_CELL_CARDS> & first = m_playArea[column1];
+	const StackFixed<Card, MAX_PLAY_CELL_CARDS> & second = m_playArea[column2];
+
+	for (int depth = 0; depth < first.Size() && depth < second.Size(); depth++)
+	{
+		if (first[depth].GetCode() != second[depth].GetCode())
+			return first[depth].GetCode() < second[depth].GetCode();
+	}
+
+	return first.Size() < second.Size();
+}
+
+/**********************************************************************
+* Purpose:
+*	To order two home cells for the standard layout by the code of
+*	their bottom card (each home cell holds a single suit). Empty home
+*	cells come last.
+*
+* Precondition:
+*	The indices of two home cells.
+*
+* Postcondition:
+*	True is returned if homeCellIndex1 comes before homeCellIndex2.
+**********************************************************************/
+bool Board::HomeCellPrecedes(int homeCellIndex1, int homeCellIndex2) const
+{
+	if (m_homeCells[homeCellIndex1].isEmpty())
+		return false;
+
+	if (m_homeCells[homeCellIndex2].isEmpty())
+		return true;
+
+	return m_homeCells[homeCellIndex1][0].GetCode() < m_homeCells[homeCellIndex2][0].GetCode();
+}
+
+/**********************************************************************
+* Purpose:
+*	To write every legal move of the selected kinds into a buffer,
+*	without changing the board, allocating, or throwing. Moves are
+*	checked with the same rules as the Move* methods, so every move
+*	written can be carried out by MakeMove(). With MOVE_FILTER_DISTINCT,
+*	only the first empty free cell, home cell, and column are used as
+*	destinations, since the others give equivalent boards.
+*
+* Precondition:
+*	A buffer of moves, its capacity, and the MOVE_FILTER_* bits of the
+*	kinds of moves wanted.
+*
+* Postcondition:
+*	The moves are written to the buffer, stopping when it is full, and
+*	the number written is returned.
+**********************************************************************/
+int Board::GenerateMoves(Move moves[], int capacity, int filter) const
+{
+	bool distinct = (filter & MOVE_FILTER_DISTINCT) != 0;	//Only the first empty destination of each kind
+	int numMoves = 0;				//Number of moves written
+	int firstEmptyFreeCell = -1;	//Index of the first empty free cell, -1 if none
+	int firstEmptyHomeCell = -1;	//Index of the first empty home cell, -1 if none
+	int firstEmptyColumn = -1;		//Index of the first empty play area column, -1 if none
+
+	for (int i = NUM_FREE_CELLS - 1; i >= 0; i--)
+	{
+		if (m_emptyFreeCell[i])
+			firstEmptyFreeCell = i;
+	}
+
+	for (int i = NUM_HOME_CELLS - 1; i >= 0; i--)
+	{
+		if (m_homeCells[i].isEmpty())
+			firstEmptyHomeCell = i;
+	}
+
+	for (int i = NUM_PLAY_CELLS - 1; i >= 0; i--)
+	{
+		if (m_playArea[i].isEmpty())
+			firstEmptyColumn = i;
+	}
+
+	//***Moves from play area to home cells
+	if (filter & MOVE_FILTER_PLAY_TO_HOME)
+	{
+		for (int column = 0; column < NUM_PLAY_CELLS; column++)
+		{
+			if (m_playArea[column].isEmpty())
+				continue;
+
+			Card card = m_playArea[column].Peek();	//Card to move
+
+			for (int home = 0; home < NUM_HOME_CELLS; home++)
+			{
+				if (m_homeCells[home].isEmpty() ? (card.GetRank() == ACE && (!distinct || home == firstEmptyHomeCell))
+					: card.CanGoHomeAfter(m_homeCells[home].Peek()))
+				{
+					if (!AppendMove(moves, capacity, numMoves, Move(PLAY_TO_HOME, column, home)))
+						return numMoves;
+				}
+			}
+		}
+	}
+
+	//***Moves from free cells to home cells
+	if (filter & MOVE_FILTER_FREE_TO_HOME)
+	{
+		for (int freeCell = 0; freeCell < NUM_FREE_CELLS; freeCell++)
+		{
+			if (m_emptyFreeCell[freeCell])
+				continue;
+
+			for (int home = 0; home < NUM_HOME_CELLS; home++)
+			{
+				if (m_homeCells[home].isEmpty() ? (m_freeCells[freeCell].GetRank() == ACE && (!distinct || home == firstEmptyHomeCell))
+					: m_freeCells[freeCell].CanGoHomeAfter(m_homeCells[home].Peek()))
+				{
+					if (!AppendMove(moves, capacity, numMoves, Move(FREE_TO_HOME, freeCell, home)))
+						return numMoves;
+				}
+			}
+		}
+	}
+
+	//***Moves from free cells to play area
+	if (filter & MOVE_FILTER_FREE_TO_PLAY)
+	{
+		for (int freeCell = 0; freeCell < NUM_FREE_CELLS; freeCell++)
+		{
+			if (m_emptyFreeCell[freeCell])
+				continue;
+
+			for (int column = 0; column < NUM_PLAY_CELLS; column++)
+			{
+				if (m_playArea[column].isEmpty() ? (!distinct || column == firstEmptyColumn)
+					: m_freeCells[freeCell].CanStackOn(m_playArea[column].Peek()))
+				{
+					if (!AppendMove(moves, capacity, numMoves, Move(FREE_TO_PLAY, freeCell, column)))
+						return numMoves;
+				}
+			}
+		}
+	}
+
+	//***Moves from play area to play area
+	if (filter & MOVE_FILTER_PLAY_TO_PLAY)
+	{
+		int maxToEmpty = 0;		//Most cards movable to an empty column
+		int maxToFilled = 0;	//Most cards movable to a non-empty column
+
+		if (firstEmptyColumn >= 0)
+			maxToEmpty = CalculateMaxMovableCards(firstEmptyColumn);
+
+		for (int column = 0; column < NUM_PLAY_CELLS; column++)
+		{
+			if (!m_playArea[column].isEmpty())
+			{
+				maxToFilled = CalculateMaxMovableCards(column);
+				break;
+			}
+		}
+
+		for (int column1 = 0; column1 < NUM_PLAY_CELLS; column1++)
+		{
+			if (m_playArea[column1].isEmpty())
+				continue;
+
+			int size = m_playArea[column1].Size();		//Cards in the column moved from
+			int runLength = GetRunLength(column1);		//Cards on top that are in order
+
+			for (int column2 = 0; column2 < NUM_PLAY_CELLS; column2++)
+			{
+				if (column2 == column1)
+					continue;
+
+				if (m_playArea[column2].isEmpty())
+				{
+					if (distinct && column2 != firstEmptyColumn)
+						continue;
+
+					//Any part of the run can start an empty column
+					for (int numCards = 1; numCards <= runLength && numCards <= maxToEmpty; numCards++)
+					{
+						if (!AppendMove(moves, capacity, numMoves, Move(PLAY_TO_PLAY, column1, column2, numCards)))
+							return numMoves;
+					}
+				}
+				else
+				{
+					//At most one part of the run stacks on the top card
+					for (int numCards = 1; numCards <= runLength && numCards <= maxToFilled; numCards++)
+					{
+						if (m_playArea[column1][size - numCards].CanStackOn(m_playArea[column2].Peek()))
+						{
+							if (!AppendMove(moves, capacity, numMoves, Move(PLAY_TO_PLAY, column1, column2, numCards)))
+								return numMoves;
+
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	//***Moves from play area to free cells
+	if (filter & MOVE_FILTER_PLAY_TO_FREE)
+	{
+		for (int column = 0; column < NUM_PLAY_CELLS; column++)
+		{
+			if (m_playArea[column].isEmpty())
+				continue;
+
+			for (int freeCell = 0; freeCell < NUM_FREE_CELLS; freeCell++)
+			{
+				if (m_emptyFreeCell[freeCell] && (!distinct || freeCell == firstEmptyFreeCell))
+				{
+					if (!AppendMove(moves, capacity, numMoves, Move(PLAY_TO_FREE, column, freeCell)))
+						return numMoves;
+				}
+			}
+		}
+	}
+
+	return numMoves;
+}
+
+/**********************************************************************
+* Purpose:
+*	To carry out a move with the Move* method of its kind.
+*
+* Precondition:
+*	An existing Move object passed by const ref.
+*
+* Postcondition:
+*	The card(s) are moved, if allowed. An Exception is thrown if not.
+**********************************************************************/
+void Board::MakeMove(const Move & move)
+{
+	switch (move.GetType())
+	{
+		case PLAY_TO_HOME:
+			MovePlayToHome(move.GetFrom(), move.GetTo());
+			break;
+		case FREE_TO_HOME:
+			MoveFreeToHome(move.GetFrom(), move.GetTo());
+			break;
+		case FREE_TO_PLAY:
+			MoveFreeToPlay(move.GetFrom(), move.GetTo());
+			break;
+		case PLAY_TO_PLAY:
+			MovePlayToPlay(move.GetFrom(), move.GetTo(), move.GetCount());
+			break;
+		case PLAY_TO_FREE:
+			MovePlayToFree(move.GetFrom(), move.GetTo());
+			break;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To reverse the last move made on the board, putting the card(s)
+*	back where they came from. The rules are not checked, since moving
+*	back is not always a legal move itself (such as a card returning
+*	to a column whose top card it does not stack on).
+*
+* Precondition:
+*	The last Move made on the board, passed by const ref.
+*
+* Postcondition:
+*	The board is as it was before the move.
+**********************************************************************/
+void Board::UndoMove(const Move & move)
+{
+	switch (move.GetType())
+	{
+		case PLAY_TO_HOME:
+			PushColumn(move.GetFrom(), PopHome(move.GetTo()));
+			break;
+		case FREE_TO_HOME:
+			FillFreeCell(move.GetFrom(), PopHome(move.GetTo()));
+			break;
+		case FREE_TO_PLAY:
+			FillFreeCell(move.GetFrom(), PopColumn(move.GetTo()));
+			break;
+		case PLAY_TO_PLAY:
+			TransferRun(move.GetTo(), move.GetFrom(), move.GetCount());
+			break;
+		case PLAY_TO_FREE:
+			//Put the card back on the column, then empty the free cell
+			PushColumn(move.GetFrom(), m_freeCells[move.GetTo()]);
+			ClearFreeCell(move.GetTo());
+			break;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card can go home without losing anything. A
+*	card in play is only ever needed to hold a card of the other color
+*	one rank lower, so once both of those are home (or the card is an
+*	ace or a two, which nothing worth keeping in play goes on) it is
+*	safe to send home.
+*
+* Precondition:
+*	An existing Card object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the card is next for its home cell and safe to
+*	send there.
+**********************************************************************/
+bool Board::IsSafeToGoHome(const Card & card) const
+{
+	int rank = card.GetRank();	//Rank of the card
+	int suit = card.GetSuit();	//Suit of the card
+
+	if (m_homeHeight[suit] != rank - 1)
+		return false;
+
+	//Suits alternate colors, so the neighbors in the Suit enum are the other color
+	return (rank <= DEUCE
+		|| (m_homeHeight[(suit + 1) % NUM_SUITS] >= rank - 1
+			&& m_homeHeight[(suit + NUM_SUITS - 1) % NUM_SUITS] >= rank - 1));
+}
+
+/**********************************************************************
+* Purpose:
+*	To send every card that is safe to go home to the home cells. Each
+*	card sent home can uncover another one, so the free cells and the
+*	tops of the columns are checked again until a pass sends nothing.
+*
+* Precondition:
+*	An optional buffer for the moves made, and the number of moves it
+*	has room for (a buffer of NUM_CARDS_DECK always has room).
+*
+* Postcondition:
+*	The safe cards are home, the moves made are in the buffer (in the
+*	order made), and the number of moves is returned. Without room in
+*	the buffer for another move, it stops early.
+**********************************************************************/
+int Board::AutoPlay(Move moves[], int capacity)
+{
+	int numMoves = 0;		//Number of cards sent home
+	bool sentHome = true;	//Flag that the last pass sent a card home
+
+	while (sentHome)
+	{
+		sentHome = false;
+
+		for (int freeCell = 0; freeCell < NUM_FREE_CELLS; freeCell++)
+		{
+			if (!m_emptyFreeCell[freeCell] && IsSafeToGoHome(m_freeCells[freeCell]))
+			{
+				Move move(FREE_TO_HOME, freeCell, FindHomeCell(m_freeCells[freeCell]));
+
+				if (moves != nullptr)
+				{
+					//Stop if the move cannot be recorded
+					if (numMoves == capacity)
+						return numMoves;
+
+					moves[numMoves] = move;
+				}
+
+				PushHome(move.GetTo(), m_freeCells[freeCell]);
+				ClearFreeCell(freeCell);
+
+				numMoves++;
+				sentHome = true;
+			}
+		}
+
+		for (int column = 0; column < NUM_PLAY_CELLS; column++)
+		{
+			//Keep taking from the same column while its top card is safe
+			while (!m_playArea[column].isEmpty() && IsSafeToGoHome(m_playArea[column].Peek()))
+			{
+				Move move(PLAY_TO_HOME, column, FindHomeCell(m_playArea[column].Peek()));
+
+				if (moves != nullptr)
+				{
+					//Stop if the move cannot be recorded
+					if (numMoves == capacity)
+						return numMoves;
+
+					moves[numMoves] = move;
+				}
+
+				PushHome(move.GetTo(), PopColumn(column));
+
+				numMoves++;
+				sentHome = true;
+			}
+		}
+	}
+
+	return numMoves;
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the home cell a card goes on: the one holding its suit, or
+*	the first empty one for an ace.
+*
+* Precondition:
+*	A card that is next for its home cell.
+*
+* Postcondition:
+*	The index of the home cell is returned.
+**********************************************************************/
+int Board::FindHomeCell(const Card & card) const
+{
+	int homeCellIndex = -1;	//Index of the home cell the card goes on
+
+	for (int i = NUM_HOME_CELLS - 1; i >= 0; i--)
+	{
+		if (m_homeCells[i].isEmpty() ? (card.GetRank() == ACE) : (m_homeCells[i].Peek().GetSuit() == card.GetSuit()))
+			homeCellIndex = i;
+	}
+
+	return homeCellIndex;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add a move to the end of a buffer if it is not full.
+*
+* Precondition:
+*	A buffer of moves, its capacity, the number of moves in it passed
+*	by ref, and the move to add.
+*
+* Postcondition:
+*	The move is added and true is returned, or false is returned if
+*	the buffer was already full.
+**********************************************************************/
+bool Board::AppendMove(Move moves[], int capacity, int & numMoves, const Move & move)
+{
+	if (numMoves >= capacity)
+		return false;
+
+	moves[numMoves++] = move;
+
+	return true;
+}
@@ -17,16 +17,32 @@
 *		the CreateBoard() method. A bool array to flag each free cell as
 *		empty is initialized to true for each element.
 *
+*	Board(const Deck & deck)
+*		Creates a board like the default constructor, but distributes
+*		the cards in the order of the given deck instead of a freshly
+*		shuffled one.
+*
+*	explicit Board(unsigned int gameNumber)
+*		Creates a board with the classic numbered deal of the given
+*		game number.
+*
+*	explicit Board(EmptyBoardTag)
+*		Creates a board with no cards, without dealing one first.
+*		Private; BoardState uses it to rebuild a Board.
+*
 *	Board(const Board & copy)
+*		Copies the board. All areas are stored inline in fixed-size
+*		stacks, so this is a flat copy with no allocation, and moving a
+*		Board (or swapping two with std::swap) is the same flat copy.
 *
 *	~Board()
 *
 *	Board & operator=(const Board & rhs)
 *
 * Methods:
-*	void CreateBoard()
-*		Distributes shuffled cards to the play area on board, and
-*		gives the free cell area empty card cells and the home cell
+*	void CreateBoard(Deck & deck)
+*		Distributes the cards of the deck to the play area on board,
+*		and gives the free cell area empty card cells and the home cell
 *		area empty stacks for future cards.
 *
 *	void MovePlayToPlay(int column1, int column2, int numCards)
@@ -45,7 +61,7 @@
 *	void MoveFreeToHome(int freeCellIndex, int homeCellIndex)
 *		Moves card from a free cell to a home cell stack.
 *
-*	int CalculateMaxMovableCards(int destColumn)
+*	int CalculateMaxMovableCards(int destColumn) const
 *		Determines maximum number of cards that can be moved at the
 *		same time from column to column in the play area.
 *
@@ -66,27 +82,181 @@
 *		Converts a suit value to a character that will be displayed to
 *		represent that suit of the given card.
 *
-*	bool WonGame()
+*	bool WonGame() const
 *		Checks if the user won the game.
 *
 *	void ResetNewBoard()
 *		Clears the original data from the free cells, home cells, and
 *		and play area, and then calls the CreateBoard() method to re-
 *		shuffle the deck and re-distribute the cards to the play area.
+*
+*	int GetColumnSize(int column) const
+*		Returns the number of cards in a play area column.
+*
+*	Card GetColumnCard(int column, int depth) const
+*		Returns the card at a depth of a play area column, counting up
+*		from the bottom card (depth 0).
+*
+*	bool isFreeCellEmpty(int freeCellIndex) const
+*		Returns true if a free cell is empty.
+*
+*	Card GetFreeCell(int freeCellIndex) const
+*		Returns the card in a (non-empty) free cell.
+*
+*	int GetHomeCellSize(int homeCellIndex) const
+*		Returns the number of cards in a home cell.
+*
+*	Card GetHomeCellTop(int homeCellIndex) const
+*		Returns the top card of a (non-empty) home cell.
+*
+*	int GetNumEmptyFreeCells() const
+*		Returns the number of empty free cells.
+*
+*	int GetNumEmptyColumns() const
+*		Returns the number of empty play area columns.
+*
+*	int GetHomeHeight(Suit suit) const
+*		Returns the number of cards of a suit in the home cells.
+*
+*	int GetNumHomeCards() const
+*		Returns the number of cards in the home cells.
+*
+*	int GetRunLength(int column) const
+*		Returns the number of cards on top of a play area column that
+*		are in order (each stacks on the card below it), the longest
+*		run that can be moved off the column together.
+*
+*	These counts are kept up to date by every change to the board, so
+*	CalculateMaxMovableCards() and WonGame() take constant time.
+*
+*	void ClearBoard()
+*		Removes every card from the board.
+*
+*	void PlaceInColumn(int column, const Card & card)
+*		Puts a card on top of a play area column without checking the
+*		rules, for setting up a position.
+*
+*	void PlaceInFreeCell(int freeCellIndex, const Card & card)
+*		Puts a card in an empty free cell without checking the rules,
+*		for setting up a position.
+*
+*	void PlaceInHomeCell(int homeCellIndex, const Card & card)
+*		Puts a card on top of a home cell without checking the rules,
+*		for setting up a position.
+*
+*	unsigned long long GetHash() const
+*		Returns the 64-bit Zobrist hash of the position. The hash is
+*		the XOR of one key per card and place, and every move updates
+*		it in O(1) by XORing out the keys of the places cards leave and
+*		XORing in the keys of the places they arrive.
+*
+*	unsigned long long ComputeHash() const
+*		Recomputes the hash from every card on the board.
+*
+*	bool operator==(const Board & rhs) const
+*		Checks if two boards hold the same cards in the same places,
+*		comparing hashes first.
+*
+*	bool operator!=(const Board & rhs) const
+*		Checks if two boards differ.
+*
+*	unsigned long long GetCanonicalHash() const
+*		Returns a hash of the position that ignores the order of the
+*		play area columns, free cells, and home cells, so every
+*		equivalent layout of a position has the same value. Like the
+*		Zobrist hash, every move updates it in O(1): each column keeps
+*		its own hash of its cards, and the canonical hash is the sum of
+*		the mixed column hashes and the cell cards' keys.
+*
+*	unsigned long long ComputeCanonicalHash() const
+*		Recomputes the canonical hash from every card on the board.
+*
+*	Board Canonicalize() const
+*		Returns the standard layout of the position, with sorted
+*		columns, free cells, and home cells. Equivalent boards have
+*		equal (==) standard layouts.
+*
+*	int GenerateMoves(Move moves[], int capacity, int filter) const
+*		Writes every legal move of the kinds selected by filter (the
+*		MOVE_FILTER_* bits of move.h) into the caller's buffer, without
+*		allocating or throwing, and returns how many were written.
+*		Play area to play area moves are listed for every run length
+*		up to the number of cards that may be moved at once. A buffer
+*		of MAX_LEGAL_MOVES always holds every move.
+*
+*	void MakeMove(const Move & move)
+*		Carries out a move with the Move* method of its kind.
+*
+*	void UndoMove(const Move & move)
+*		Reverses the last move made on the board, without checking the
+*		rules (the reversed move need not be legal itself).
+*
+*	bool IsSafeToGoHome(const Card & card) const
+*		Returns true if a card is next for its home cell and no card
+*		left on the board could ever need to be stacked on it: it is an
+*		ace or a two, or both home cells of the other color already
+*		hold the cards one rank below it.
+*
+*	int AutoPlay(Move moves[], int capacity)
+*		Sends every card that is safe to go home to the home cells from
+*		the play area and the free cells, again and again until none
+*		are left, and returns how many were sent. The moves are written
+*		into the buffer (if one is given) so they can be undone; it
+*		stops when the buffer is full. A buffer of NUM_CARDS_DECK always
+*		holds every move.
+*
+*	MoveStatus CanMovePlayToPlay(int column1, int column2, int numCards) const
+*	MoveStatus CanMovePlayToFree(int column, int freeCellIndex) const
+*	MoveStatus CanMovePlayToHome(int column, int homeCellIndex) const
+*	MoveStatus CanMoveFreeToPlay(int freeCellIndex, int column) const
+*	MoveStatus CanMoveFreeToHome(int freeCellIndex, int homeCellIndex) const
+*		Check whether the matching Move* method would succeed, without
+*		changing the board or throwing, and return MOVE_OK or the
+*		reason it would fail. The Move* methods throw the
+*		MoveStatusMessage() of the status. The rules themselves are the
+*		Check* functions of move.h, which BoardState uses as well.
+*
+*	MoveStatus CanMove(const Move & move) const
+*		Checks a move with the CanMove* method of its kind.
+*
+*	MoveStatus TryMove(const Move & move)
+*		Makes a move if it is allowed, without throwing, and returns
+*		its status.
+*
+* std::hash<Board>
+*	Hashes a Board by its Zobrist hash, so Boards can be keys of
+*	unordered containers.
 **********************************************************************/
 #ifndef BOARD_H
 #define BOARD_H
 
-#include "stackArray.h"
-#include "stackLL.h"
+#include "stackFixed.h"
 #include "deck.h"
+#include "prng.h"
+#include "move.h"
 
+#include <functional>
 #include <string>
 using std::string;
 
 const int NUM_FREE_CELLS = 4;
 const int NUM_HOME_CELLS = 4;
 const int NUM_PLAY_CELLS = 8;
+const int MAX_PLAY_CELL_CARDS = 19;	//7 dealt cards plus a run from Queen down to Ace
+
+//Most legal moves any board can have (a run of each length to each other column, and every single card move)
+const int MAX_LEGAL_MOVES = NUM_PLAY_CELLS * (NUM_PLAY_CELLS - 1) * NUM_RANKS
+	+ NUM_PLAY_CELLS * (NUM_FREE_CELLS + NUM_HOME_CELLS) + NUM_FREE_CELLS * (NUM_PLAY_CELLS + NUM_HOME_CELLS);
+
+//Zobrist key indices: play area keys first, then free cell keys, then home cell keys
+const unsigned long long ZOBRIST_BASE = 0x5A0B12C7ULL;	//Keeps every index away from zero (Mix(0) is 0)
+const int ZOBRIST_FREE_OFFSET = NUM_PLAY_CELLS * MAX_PLAY_CELL_CARDS * NUM_CARD_CODES;
+const int ZOBRIST_HOME_OFFSET = ZOBRIST_FREE_OFFSET + NUM_FREE_CELLS * NUM_CARD_CODES;
+
+//Canonical key indices follow the Zobrist ones and leave out the column and cell index
+const int CANONICAL_COLUMN_OFFSET = ZOBRIST_HOME_OFFSET + NUM_HOME_CELLS * NUM_CARD_CODES;
+const int CANONICAL_FREE_OFFSET = CANONICAL_COLUMN_OFFSET + MAX_PLAY_CELL_CARDS * NUM_CARD_CODES;
+const int CANONICAL_HOME_OFFSET = CANONICAL_FREE_OFFSET + NUM_CARD_CODES;
 
 class Board
 {
@@ -94,14 +264,20 @@ class Board
 		//Default Ctor
 		Board();
 
-		//Copy Ctor
-		Board(const Board & copy);
+		//1-Arg Overloaded Ctor
+		Board(const Deck & deck);
+
+		//1-Arg Overloaded Ctor
+		explicit Board(unsigned int gameNumber);
+
+		//Copy Ctor (trivial, all areas are stored inline)
+		Board(const Board & copy) = default;
 
 		//Default Dtor
-		~Board();
+		~Board() = default;
 
 		//Assignment Operator
-		Board & operator=(const Board & rhs);
+		Board & operator=(const Board & rhs) = default;
 
 		//Move from Play Area to Play Area
 		void MovePlayToPlay(int column1, int column2, int numCards);
@@ -122,17 +298,135 @@ class Board
 		void DisplayBoard();
 
 		//Check if user won the game
-		bool WonGame();
+		bool WonGame() const;
 
 		//Reset game to start over
 		void ResetNewBoard();
 
+		//Returns the number of cards in a play area column
+		int GetColumnSize(int column) const;
+
+		//Returns the card at a depth of a play area column, counting up from the bottom
+		Card GetColumnCard(int column, int depth) const;
+
+		//Returns true if a free cell is empty
+		bool isFreeCellEmpty(int freeCellIndex) const;
+
+		//Returns the card in a free cell
+		Card GetFreeCell(int freeCellIndex) const;
+
+		//Returns the number of cards in a home cell
+		int GetHomeCellSize(int homeCellIndex) const;
+
+		//Returns the top card of a home cell
+		Card GetHomeCellTop(int homeCellIndex) const;
+
+		//Returns the number of empty free cells
+		int GetNumEmptyFreeCells() const;
+
+		//Returns the number of empty play area columns
+		int GetNumEmptyColumns() const;
+
+		//Returns the number of cards of a suit in the home cells
+		int GetHomeHeight(Suit suit) const;
+
+		//Returns the number of cards in the home cells
+		int GetNumHomeCards() const;
+
+		//Returns the number of cards in order on top of a play area column
+		int GetRunLength(int column) const;
+
+		//Removes every card from the board
+		void ClearBoard();
+
+		//Puts a card on a play area column (no rules checked)
+		void PlaceInColumn(int column, const Card & card);
+
+		//Puts a card in an empty free cell (no rules checked)
+		void PlaceInFreeCell(int freeCellIndex, const Card & card);
+
+		//Puts a card on a home cell (no rules checked)
+		void PlaceInHomeCell(int homeCellIndex, const Card & card);
+
+		//Returns the Zobrist hash of the position
+		unsigned long long GetHash() const;
+
+		//Recomputes the Zobrist hash from every card
+		unsigned long long ComputeHash() const;
+
+		//Equality Operator
+		bool operator==(const Board & rhs) const;
+
+		//Inequality Operator
+		bool operator!=(const Board & rhs) const;
+
+		//Returns the hash that ignores column and cell order
+		unsigned long long GetCanonicalHash() const;
+
+		//Recomputes the canonical hash from every card
+		unsigned long long ComputeCanonicalHash() const;
+
+		//Returns the board with sorted columns and cells
+		Board Canonicalize() const;
+
+		//Writes the legal moves into a buffer and returns how many
+		int GenerateMoves(Move moves[], int capacity, int filter = MOVE_FILTER_ALL) const;
+
+		//Carries out a move
+		void MakeMove(const Move & move);
+
+		//Reverses the last move made
+		void UndoMove(const Move & move);
+
+		//Checks if a card can go home without ever being needed in play
+		bool IsSafeToGoHome(const Card & card) const;
+
+		//Sends safe cards home until none are left and returns how many
+		int AutoPlay(Move moves[] = nullptr, int capacity = 0);
+
+		//Check moves without making them
+		MoveStatus CanMovePlayToPlay(int column1, int column2, int numCards) const;
+		MoveStatus CanMovePlayToFree(int column, int freeCellIndex) const;
+		MoveStatus CanMovePlayToHome(int column, int homeCellIndex) const;
+		MoveStatus CanMoveFreeToPlay(int freeCellIndex, int column) const;
+		MoveStatus CanMoveFreeToHome(int freeCellIndex, int homeCellIndex) const;
+
+		//Checks a move of any kind without making it
+		MoveStatus CanMove(const Move & move) const;
+
+		//Makes a move if it is allowed and returns its status
+		MoveStatus TryMove(const Move & move);
+
 	private:
+		//BoardState builds Boards with the empty board Ctor
+		friend class BoardState;
+
+		//Tag that picks the empty board Ctor
+		enum EmptyBoardTag { EMPTY_BOARD };
+
+		//1-Arg Overloaded Ctor (board with no cards)
+		explicit Board(EmptyBoardTag);
+
 		//Distribute cards on board
-		void CreateBoard();
+		void CreateBoard(Deck & deck);
 
 		//Determine max number of cards to move
-		int CalculateMaxMovableCards(int destColumn);
+		int CalculateMaxMovableCards(int destColumn) const;
+
+		//Returns the top card of a play area column, Card(NO_CARD_CODE) if empty
+		Card ColumnTopOrNone(int column) const;
+
+		//Returns the card in a free cell, Card(NO_CARD_CODE) if empty
+		Card FreeCellOrNone(int freeCellIndex) const;
+
+		//Returns the top card of a home cell, Card(NO_CARD_CODE) if empty
+		Card HomeCellTopOrNone(int homeCellIndex) const;
+
+		//Find the home cell a card is next for
+		int FindHomeCell(const Card & card) const;
+
+		//Add a move to a buffer if there is room
+		static bool AppendMove(Move moves[], int capacity, int & numMoves, const Move & move);
 
 		//Display an empty cell location for a card
 		void DisplayEmptyCell();
@@ -146,10 +440,587 @@ class Board
 		//Convert suit value to a character to be displayed
 		char ConvertSuit(const Card & card);
 
-		Array<Card> m_freeCells;				//Cards in Free Cell Area
-		Array<StackArray<Card>> m_homeCells;	//Stack of Cards in Home Cell Area
-		Array<StackLL<Card>> m_playArea;		//Stack of Cards in Play Area
+		//Push a card on a play area column and hash it in
+		void PushColumn(int column, const Card & card);
+
+		//Pop a card off a play area column and hash it out
+		Card PopColumn(int column);
+
+		//Move a checked run between play area columns as one block
+		void TransferRun(int column1, int column2, int numCards);
+
+		//Push a card on a home cell and hash it in
+		void PushHome(int homeCellIndex, const Card & card);
+
+		//Pop a card off a home cell and hash it out
+		Card PopHome(int homeCellIndex);
+
+		//Put a card in an empty free cell and hash it in
+		void FillFreeCell(int freeCellIndex, const Card & card);
+
+		//Empty a free cell and hash its card out
+		void ClearFreeCell(int freeCellIndex);
+
+		//Zobrist keys of a card in each kind of place
+		static unsigned long long ColumnKey(int column, int depth, const Card & card);
+		static unsigned long long FreeCellKey(int freeCellIndex, const Card & card);
+		static unsigned long long HomeCellKey(int homeCellIndex, const Card & card);
+
+		//Keys of a card in each kind of place, whichever column or cell it is in
+		static unsigned long long CanonicalColumnKey(int depth, const Card & card);
+		static unsigned long long CanonicalFreeCellKey(const Card & card);
+		static unsigned long long CanonicalHomeCellKey(const Card & card);
+
+		//Order two columns for Canonicalize()
+		bool ColumnPrecedes(int column1, int column2) const;
+
+		//Order two home cells for Canonicalize()
+		bool HomeCellPrecedes(int homeCellIndex1, int homeCellIndex2) const;
+
+		Card m_freeCells[NUM_FREE_CELLS];									//Cards in Free Cell Area
+		StackFixed<Card, NUM_RANKS> m_homeCells[NUM_HOME_CELLS];			//Stack of Cards in Home Cell Area
+		StackFixed<Card, MAX_PLAY_CELL_CARDS> m_playArea[NUM_PLAY_CELLS];	//Stack of Cards in Play Area
 		bool m_emptyFreeCell[NUM_FREE_CELLS];	//Flags whether each Free Cell is empty
+		unsigned long long m_hash;				//Zobrist hash of the cards in every area
+		unsigned long long m_columnHash[NUM_PLAY_CELLS];	//Hash of each column's cards alone
+		unsigned long long m_canonicalHash;		//Hash that ignores column and cell order
+		int m_numEmptyFreeCells;				//Number of empty Free Cells
+		int m_numEmptyColumns;					//Number of empty Play Area columns
+		int m_homeHeight[NUM_SUITS];			//Number of Cards of each suit in Home Cell Area
+		int m_numHomeCards;						//Number of Cards in Home Cell Area
+		unsigned char m_runLength[NUM_PLAY_CELLS][MAX_PLAY_CELL_CARDS];	//Length of the ordered run ending at each card of each column
 };
 
+/**********************************************************************
+* Purpose:
+*	To return the number of cards in a play area column.
+*
+* Precondition:
+*	The index of a play area column.
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+inline int Board::GetColumnSize(int column) const
+{
+	return m_playArea[column].Size();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a card of a play area column without removing it,
+*	counting up from the bottom card of the column.
+*
+* Precondition:
+*	The index of a play area column and a depth from 0 (bottom card)
+*	to GetColumnSize() - 1 (top card).
+*
+* Postcondition:
+*	The card at that depth is returned.
+**********************************************************************/
+inline Card Board::GetColumnCard(int column, int depth) const
+{
+	return m_playArea[column][depth];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not a free cell is empty.
+*
+* Precondition:
+*	The index of a free cell.
+*
+* Postcondition:
+*	True is returned if the free cell is empty.
+**********************************************************************/
+inline bool Board::isFreeCellEmpty(int freeCellIndex) const
+{
+	return m_emptyFreeCell[freeCellIndex];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the card in a free cell without removing it.
+*
+* Precondition:
+*	The index of a free cell that is not empty.
+*
+* Postcondition:
+*	The card in the free cell is returned.
+**********************************************************************/
+inline Card Board::GetFreeCell(int freeCellIndex) const
+{
+	return m_freeCells[freeCellIndex];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards in a home cell.
+*
+* Precondition:
+*	The index of a home cell.
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+inline int Board::GetHomeCellSize(int homeCellIndex) const
+{
+	return m_homeCells[homeCellIndex].Size();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a home cell without removing it.
+*
+* Precondition:
+*	The index of a home cell that is not empty.
+*
+* Postcondition:
+*	The top card of the home cell is returned.
+**********************************************************************/
+inline Card Board::GetHomeCellTop(int homeCellIndex) const
+{
+	return m_homeCells[homeCellIndex].Peek();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of empty free cells.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of empty free cells is returned.
+**********************************************************************/
+inline int Board::GetNumEmptyFreeCells() const
+{
+	return m_numEmptyFreeCells;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of empty play area columns.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of empty columns is returned.
+**********************************************************************/
+inline int Board::GetNumEmptyColumns() const
+{
+	return m_numEmptyColumns;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return how many cards of a suit are in the home cells, which is
+*	also the rank of the highest one.
+*
+* Precondition:
+*	A suit.
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+inline int Board::GetHomeHeight(Suit suit) const
+{
+	return m_homeHeight[suit];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards in the home cells.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+inline int Board::GetNumHomeCards() const
+{
+	return m_numHomeCards;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards on top of a play area column that
+*	are in order. Each push records the length of the run ending at the
+*	new card, so this is a lookup.
+*
+* Precondition:
+*	The index of a play area column.
+*
+* Postcondition:
+*	The length of the run is returned (0 if the column is empty).
+**********************************************************************/
+inline int Board::GetRunLength(int column) const
+{
+	int size = m_playArea[column].Size();	//Cards in the column
+
+	return (size == 0) ? 0 : m_runLength[column][size - 1];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a play area column in the form the move
+*	rules of move.h take.
+*
+* Precondition:
+*	The index of a play area column.
+*
+* Postcondition:
+*	The top card is returned, or Card(NO_CARD_CODE) if the column is
+*	empty.
+**********************************************************************/
+inline Card Board::ColumnTopOrNone(int column) const
+{
+	return m_playArea[column].isEmpty() ? Card(NO_CARD_CODE) : m_playArea[column].Peek();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the card in a free cell in the form the move rules of
+*	move.h take.
+*
+* Precondition:
+*	The index of a free cell.
+*
+* Postcondition:
+*	The card is returned, or Card(NO_CARD_CODE) if the free cell is
+*	empty.
+**********************************************************************/
+inline Card Board::FreeCellOrNone(int freeCellIndex) const
+{
+	return m_emptyFreeCell[freeCellIndex] ? Card(NO_CARD_CODE) : m_freeCells[freeCellIndex];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a home cell in the form the move rules
+*	of move.h take.
+*
+* Precondition:
+*	The index of a home cell.
+*
+* Postcondition:
+*	The top card is returned, or Card(NO_CARD_CODE) if the home cell
+*	is empty.
+**********************************************************************/
+inline Card Board::HomeCellTopOrNone(int homeCellIndex) const
+{
+	return m_homeCells[homeCellIndex].isEmpty() ? Card(NO_CARD_CODE) : m_homeCells[homeCellIndex].Peek();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the Zobrist key of a card at a depth of a play area
+*	column. Keys are derived by mixing a distinct index for every
+*	(column, depth, card) instead of being read from a table.
+*
+* Precondition:
+*	The index of a play area column, a depth in the column, and a card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::ColumnKey(int column, int depth, const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + (column * MAX_PLAY_CELL_CARDS + depth) * NUM_CARD_CODES + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the Zobrist key of a card in a free cell.
+*
+* Precondition:
+*	The index of a free cell and a card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::FreeCellKey(int freeCellIndex, const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + ZOBRIST_FREE_OFFSET + freeCellIndex * NUM_CARD_CODES + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the Zobrist key of a card in a home cell.
+*
+* Precondition:
+*	The index of a home cell and a card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::HomeCellKey(int homeCellIndex, const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + ZOBRIST_HOME_OFFSET + homeCellIndex * NUM_CARD_CODES + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the canonical key of a card at a depth of a play area
+*	column, the same for every column.
+*
+* Precondition:
+*	A depth in a column and a card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::CanonicalColumnKey(int depth, const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + CANONICAL_COLUMN_OFFSET + depth * NUM_CARD_CODES + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the canonical key of a card in a free cell, the same for
+*	every free cell.
+*
+* Precondition:
+*	A card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::CanonicalFreeCellKey(const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + CANONICAL_FREE_OFFSET + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the canonical key of a card in a home cell, the same for
+*	every home cell.
+*
+* Precondition:
+*	A card.
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+inline unsigned long long Board::CanonicalHomeCellKey(const Card & card)
+{
+	return Prng::Mix(ZOBRIST_BASE + CANONICAL_HOME_OFFSET + card.GetCode());
+}
+
+/**********************************************************************
+* Purpose:
+*	To push a card on top of a play area column, XOR its key into the
+*	hash, update the canonical hash and the empty column count, and
+*	record the length of the run the card ends.
+*
+* Precondition:
+*	The index of a play area column that is not full and a card.
+*
+* Postcondition:
+*	The card is on top of the column and the hash includes it.
+**********************************************************************/
+inline void Board::PushColumn(int column, const Card & card)
+{
+	int depth = m_playArea[column].Size();	//Depth the card lands at
+
+	m_hash ^= ColumnKey(column, depth, card);
+
+	//Swap the column's term of the canonical hash for its new one
+	m_canonicalHash -= Prng::Mix(m_columnHash[column]);
+	m_columnHash[column] ^= CanonicalColumnKey(depth, card);
+	m_canonicalHash += Prng::Mix(m_columnHash[column]);
+
+	if (depth == 0)
+		m_numEmptyColumns--;
+
+	//The card extends the run below it if it stacks on it, else starts a new one
+	if (depth > 0 && card.CanStackOn(m_playArea[column].Peek()))
+		m_runLength[column][depth] = m_runLength[column][depth - 1] + 1;
+	else
+		m_runLength[column][depth] = 1;
+
+	m_playArea[column].Push(card);
+}
+
+/**********************************************************************
+* Purpose:
+*	To pop the top card of a play area column, XOR its key out of the
+*	hash, and update the canonical hash and the empty column count.
+*
+* Precondition:
+*	The index of a play area column that is not empty.
+*
+* Postcondition:
+*	The card is removed from the column and the hash, and returned.
+**********************************************************************/
+inline Card Board::PopColumn(int column)
+{
+	Card card = m_playArea[column].Pop();	//Card leaving the column
+	int depth = m_playArea[column].Size();	//Depth the card left from
+
+	m_hash ^= ColumnKey(column, depth, card);
+
+	//Swap the column's term of the canonical hash for its new one
+	m_canonicalHash -= Prng::Mix(m_columnHash[column]);
+	m_columnHash[column] ^= CanonicalColumnKey(depth, card);
+	m_canonicalHash += Prng::Mix(m_columnHash[column]);
+
+	if (depth == 0)
+		m_numEmptyColumns++;
+
+	return card;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the top cards of a play area column onto another column as
+*	one block: the cards are copied out and in with PopBlock() and
+*	PushBlock(), and only the hashes, run lengths, and counts are
+*	updated card by card.
+*
+* Precondition:
+*	A move of numCards cards from column1 to column2 that
+*	CanMovePlayToPlay() allows, or that undoes such a move.
+*
+* Postcondition:
+*	The cards are on top of column2, in the same order, and the hashes,
+*	run lengths, and counts match the board.
+**********************************************************************/
+inline void Board::TransferRun(int column1, int column2, int numCards)
+{
+	Card block[MAX_PLAY_CELL_CARDS];	//Cards being moved, lowest first
+	int depth1 = m_playArea[column1].Size() - numCards;	//Depth of the lowest moved card in column1
+	int depth2 = m_playArea[column2].Size();			//Depth it lands at in column2
+	int runBase = 0;		//Length of the run the block extends
+
+	m_playArea[column1].PopBlock(block, numCards);
+
+	//An undone move may put the block on a card it does not stack on
+	if (depth2 > 0 && block[0].CanStackOn(m_playArea[column2].Peek()))
+		runBase = m_runLength[column2][depth2 - 1];
+
+	m_canonicalHash -= Prng::Mix(m_columnHash[column1]) + Prng::Mix(m_columnHash[column2]);
+
+	for (int i = 0; i < numCards; i++)
+	{
+		m_hash ^= ColumnKey(column1, depth1 + i, block[i]) ^ ColumnKey(column2, depth2 + i, block[i]);
+		m_columnHash[column1] ^= CanonicalColumnKey(depth1 + i, block[i]);
+		m_columnHash[column2] ^= CanonicalColumnKey(depth2 + i, block[i]);
+
+		//The block is in order, so each card extends the run by one
+		m_runLength[column2][depth2 + i] = static_cast<unsigned char>(runBase + 1 + i);
+	}
+
+	m_canonicalHash += Prng::Mix(m_columnHash[column1]) + Prng::Mix(m_columnHash[column2]);
+
+	if (depth1 == 0)
+		m_numEmptyColumns++;
+
+	if (depth2 == 0)
+		m_numEmptyColumns--;
+
+	m_playArea[column2].PushBlock(block, numCards);
+}
+
+/**********************************************************************
+* Purpose:
+*	To push a card on top of a home cell, XOR its key into the hash,
+*	and update the canonical hash and the home cell counts.
+*
+* Precondition:
+*	The index of a home cell that is not full and a card.
+*
+* Postcondition:
+*	The card is on top of the home cell and the hash includes it.
+**********************************************************************/
+inline void Board::PushHome(int homeCellIndex, const Card & card)
+{
+	m_hash ^= HomeCellKey(homeCellIndex, card);
+	m_canonicalHash += CanonicalHomeCellKey(card);
+	m_homeHeight[card.GetSuit()]++;
+	m_numHomeCards++;
+	m_homeCells[homeCellIndex].Push(card);
+}
+
+/**********************************************************************
+* Purpose:
+*	To pop the top card of a home cell, XOR its key out of the hash,
+*	and update the canonical hash and the home cell counts.
+*
+* Precondition:
+*	The index of a home cell that is not empty.
+*
+* Postcondition:
+*	The card is removed from the home cell, the hashes, and the counts,
+*	and returned.
+**********************************************************************/
+inline Card Board::PopHome(int homeCellIndex)
+{
+	Card card = m_homeCells[homeCellIndex].Pop();	//Card leaving the home cell
+
+	m_hash ^= HomeCellKey(homeCellIndex, card);
+	m_canonicalHash -= CanonicalHomeCellKey(card);
+	m_homeHeight[card.GetSuit()]--;
+	m_numHomeCards--;
+
+	return card;
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a card in an empty free cell, XOR its key into the hash, and
+*	update the canonical hash and the empty free cell count.
+*
+* Precondition:
+*	The index of an empty free cell and a card.
+*
+* Postcondition:
+*	The free cell holds the card, is flagged as non-empty, and the
+*	hash includes the card.
+**********************************************************************/
+inline void Board::FillFreeCell(int freeCellIndex, const Card & card)
+{
+	m_freeCells[freeCellIndex] = card;
+	m_emptyFreeCell[freeCellIndex] = false;
+	m_hash ^= FreeCellKey(freeCellIndex, card);
+	m_canonicalHash += CanonicalFreeCellKey(card);
+	m_numEmptyFreeCells--;
+}
+
+/**********************************************************************
+* Purpose:
+*	To empty a free cell, XOR its card's key out of the hash, and update
+*	the canonical hash and the empty free cell count. The card itself
+*	is left in place, as the moves have already copied it.
+*
+* Precondition:
+*	The index of a non-empty free cell.
+*
+* Postcondition:
+*	The free cell is flagged as empty and the hash no longer includes
+*	its card.
+**********************************************************************/
+inline void Board::ClearFreeCell(int freeCellIndex)
+{
+	m_hash ^= FreeCellKey(freeCellIndex, m_freeCells[freeCellIndex]);
+	m_canonicalHash -= CanonicalFreeCellKey(m_freeCells[freeCellIndex]);
+	m_emptyFreeCell[freeCellIndex] = true;
+	m_numEmptyFreeCells++;
+}
+
+namespace std
+{
+	//Hashes a Board by its Zobrist hash
+	template <>
+	struct hash<Board>
+	{
+		size_t operator()(const Board & board) const
+		{
+			return static_cast<size_t>(board.GetHash());
+		}
+	};
+}
+
 #endif //BOARD_H
\ No newline at end of file
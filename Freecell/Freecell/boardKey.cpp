@@ -0,0 +1,300 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			boardKey.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "boardKey.h"
+
+#include <bitset>
+
+/**********************************************************************
+* Purpose:
+*	To construct a BoardKey with every word zero.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to zero.
+**********************************************************************/
+BoardKey::BoardKey() : m_layout(0)
+{
+	for (int i = 0; i < BOARD_KEY_ORDER_WORDS; i++)
+		m_order[i] = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct the BoardKey of an existing Board.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	The key describes the board.
+**********************************************************************/
+BoardKey::BoardKey(const Board & board)
+{
+	Encode(board);
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the key to that of a board. The home cells are written to
+*	the layout word first, which leaves the cards not at home; those are
+*	then numbered in column order and free cell order, and the numbers
+*	are packed into the Lehmer code.
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref.
+*
+* Postcondition:
+*	The key describes the board.
+**********************************************************************/
+void BoardKey::Encode(const Board & board)
+{
+	unsigned int value[BOARD_KEY_ORDER_LIMBS] = {};	//Lehmer code, least significant limb first
+	unsigned long long remaining = FULL_DECK_MASK;	//Cards not yet numbered
+	unsigned int radix = 0;							//Number of cards not yet numbered
+
+	m_layout = 0;
+
+	//Record each home cell's height and suit and take its cards out
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		int height = board.GetHomeCellSize(i);
+		int suit = (height == 0) ? 0 : CARD_SUIT[board.GetHomeCellTop(i).GetCode()];
+
+		m_layout |= static_cast<unsigned long long>(height | (suit << 4)) << (BOARD_KEY_HOME_SHIFT + i * BOARD_KEY_HOME_BITS);
+		remaining &= ~(((1ULL << height) - 1) << (suit * 16 + ACE));
+	}
+
+	radix = CountCards(remaining);
+
+	//Number the cards of each column from the bottom up
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		int size = board.GetColumnSize(i);
+
+		//The last column's length is whatever cards are left over
+		if (i < NUM_PLAY_CELLS - 1)
+			m_layout |= static_cast<unsigned long long>(size) << (i * BOARD_KEY_LENGTH_BITS);
+
+		for (int depth = 0; depth < size; depth++)
+			MultiplyAdd(value, radix--, TakeDigit(remaining, board.GetColumnCard(i, depth)));
+	}
+
+	//Number the cards of the free cells
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (!board.isFreeCellEmpty(i))
+		{
+			m_layout |= 1ULL << (BOARD_KEY_FREE_SHIFT + i);
+			MultiplyAdd(value, radix--, TakeDigit(remaining, board.GetFreeCell(i)));
+		}
+	}
+
+	//Pack pairs of limbs into words
+	for (int i = 0; i < BOARD_KEY_ORDER_WORDS; i++)
+		m_order[i] = value[2 * i] | (static_cast<unsigned long long>(value[2 * i + 1]) << 32);
+}
+
+/**********************************************************************
+* Purpose:
+*	To set a board to the position of the key. The home cells are
+*	rebuilt first, which gives the cards not at home; the numbers of
+*	those cards are unpacked from the Lehmer code last card first, then
+*	the cards are placed in column order and free cell order.
+*
+* Precondition:
+*	A key made from a board and a Board object passed by ref (its
+*	cards are replaced).
+*
+* Postcondition:
+*	The board holds the position of the key, and its hashes are up to
+*	date.
+**********************************************************************/
+void BoardKey::Decode(Board & board) const
+{
+	unsigned int value[BOARD_KEY_ORDER_LIMBS];		//Lehmer code, least significant limb first
+	unsigned char digits[NUM_CARDS_DECK];			//Number of each card not at home
+	unsigned long long remaining = FULL_DECK_MASK;	//Cards not yet placed
+	int numCards = 0;								//Number of cards not at home
+	int numFreeCards = 0;							//Number of occupied free cells
+	int position = 0;								//Number of cards placed so far
+	int lastColumnSize = 0;							//Cards left over for the last column
+
+	board.ClearBoard();
+
+	//Unpack words into pairs of limbs
+	for (int i = 0; i < BOARD_KEY_ORDER_WORDS; i++)
+	{
+		value[2 * i] = static_cast<unsigned int>(m_order[i]);
+		value[2 * i + 1] = static_cast<unsigned int>(m_order[i] >> 32);
+	}
+
+	//Rebuild each home cell from the ace up and take its cards out
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		int bits = static_cast<int>(m_layout >> (BOARD_KEY_HOME_SHIFT + i * BOARD_KEY_HOME_BITS));
+		int height = bits & 0xF;
+		Suit suit = static_cast<Suit>((bits >> 4) & 0x3);
+
+		for (int rank = ACE; rank <= height; rank++)
+			board.PlaceInHomeCell(i, Card(static_cast<Rank>(rank), suit));
+
+		remaining &= ~(((1ULL << height) - 1) << (suit * 16 + ACE));
+	}
+
+	numCards = CountCards(remaining);
+
+	//The last card was numbered first in radix 1, so unpack from the end
+	for (int i = numCards - 1; i >= 0; i--)
+		digits[i] = static_cast<unsigned char>(DivideRemainder(value, numCards - i));
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (m_layout & (1ULL << (BOARD_KEY_FREE_SHIFT + i)))
+			numFreeCards++;
+	}
+
+	lastColumnSize = numCards - numFreeCards;
+
+	//Place the cards of each column from the bottom up
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		int size = lastColumnSize;
+
+		if (i < NUM_PLAY_CELLS - 1)
+		{
+			size = static_cast<int>(m_layout >> (i * BOARD_KEY_LENGTH_BITS)) & ((1 << BOARD_KEY_LENGTH_BITS) - 1);
+			lastColumnSize -= size;
+		}
+
+		for (int depth = 0; depth < size; depth++)
+			board.PlaceInColumn(i, TakeCard(remaining, digits[position++]));
+	}
+
+	//Place the cards of the free cells
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (m_layout & (1ULL << (BOARD_KEY_FREE_SHIFT + i)))
+			board.PlaceInFreeCell(i, TakeCard(remaining, digits[position++]));
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To multiply a Lehmer code by a radix and add a digit below it.
+*
+* Precondition:
+*	The limbs of a Lehmer code, a radix, and a digit less than the
+*	radix. The result must fit in the limbs.
+*
+* Postcondition:
+*	The limbs hold value * radix + digit.
+**********************************************************************/
+void BoardKey::MultiplyAdd(unsigned int value[], unsigned int radix, unsigned int digit)
+{
+	unsigned long long carry = digit;	//Carried into the next limb
+
+	for (int i = 0; i < BOARD_KEY_ORDER_LIMBS; i++)
+	{
+		carry += static_cast<unsigned long long>(value[i]) * radix;
+		value[i] = static_cast<unsigned int>(carry);
+		carry >>= 32;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To divide a Lehmer code by a radix, giving back the lowest digit.
+*
+* Precondition:
+*	The limbs of a Lehmer code and a non-zero radix.
+*
+* Postcondition:
+*	The limbs hold value / radix, and value % radix is returned.
+**********************************************************************/
+unsigned int BoardKey::DivideRemainder(unsigned int value[], unsigned int radix)
+{
+	unsigned long long remainder = 0;	//Remainder carried into the next lower limb
+
+	for (int i = BOARD_KEY_ORDER_LIMBS - 1; i >= 0; i--)
+	{
+		unsigned long long current = (remainder << 32) | value[i];
+
+		value[i] = static_cast<unsigned int>(current / radix);
+		remainder = current % radix;
+	}
+
+	return static_cast<unsigned int>(remainder);
+}
+
+/**********************************************************************
+* Purpose:
+*	To number a card by how many of the remaining cards have a lower
+*	code, and remove it from the remaining cards.
+*
+* Precondition:
+*	A mask of the remaining cards passed by ref and a card in it.
+*
+* Postcondition:
+*	The card is removed from the mask and its number is returned.
+**********************************************************************/
+unsigned int BoardKey::TakeDigit(unsigned long long & remaining, const Card & card)
+{
+	unsigned long long bit = 1ULL << card.GetCode();	//Bit of the card in the mask
+
+	remaining &= ~bit;
+
+	return static_cast<unsigned int>(CountCards(remaining & (bit - 1)));
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the remaining card with a given number (the number of
+*	remaining cards with a lower code), and remove it from the
+*	remaining cards.
+*
+* Precondition:
+*	A mask of the remaining cards passed by ref and a number less than
+*	the count of remaining cards.
+*
+* Postcondition:
+*	The card is removed from the mask and returned.
+**********************************************************************/
+Card BoardKey::TakeCard(unsigned long long & remaining, unsigned int digit)
+{
+	unsigned long long search = remaining;	//Remaining cards not yet passed over
+
+	//Drop the lowest cards the digit counts past
+	for (unsigned int i = 0; i < digit; i++)
+		search &= search - 1;
+
+	unsigned char code = 0;	//Code of the lowest card left in search
+
+	while (!(search & (1ULL << code)))
+		code++;
+
+	remaining &= ~(1ULL << code);
+
+	return Card(code);
+}
+
+/**********************************************************************
+* Purpose:
+*	To count the cards of a card code mask.
+*
+* Precondition:
+*	A mask with a bit set for each card code.
+*
+* Postcondition:
+*	The number of set bits is returned.
+**********************************************************************/
+int BoardKey::CountCards(unsigned long long mask)
+{
+	return static_cast<int>(std::bitset<NUM_CARD_CODES>(mask).count());
+}
@@ -0,0 +1,200 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			boardKey.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: BoardKey
+*
+* Purpose:
+*	This class packs a whole Board into 40 bytes: the order of the cards
+*	that are not in a home cell, and one word describing where they go.
+*	It is trivially copyable with a fixed size, so it can be stored
+*	directly in hash tables, written to disk as raw bytes for search
+*	frontiers and saved sessions, and compared word by word.
+*
+*	The cards not at home are listed column by column from the bottom
+*	up, then free cell by free cell. Their order is stored as a Lehmer
+*	code: each card is numbered by how many of the cards still to come
+*	have a lower code, and those numbers are packed as one mixed-radix
+*	number, which for 52 cards is below 52! < 2^226 and fits in four
+*	words. The layout word holds the lengths of the first seven columns
+*	(5 bits each, the eighth follows from the card count), which free
+*	cells are occupied (4 bits), and each home cell's height (4 bits)
+*	and suit (2 bits); the home heights tell which cards are listed.
+*
+* Manager functions:
+*	BoardKey()
+*		Creates a key with every word zero, which marks an empty table
+*		slot rather than a position.
+*
+*	explicit BoardKey(const Board & board)
+*		Creates the key of the given board.
+*
+* Methods:
+*	void Encode(const Board & board)
+*		Sets the key to that of the given board.
+*
+*	void Decode(Board & board) const
+*		Sets the given board to the position of the key, with its
+*		hashes up to date.
+*
+*	bool operator==(const BoardKey & rhs) const
+*		Checks if two keys (and so their boards) are identical.
+*
+*	bool operator!=(const BoardKey & rhs) const
+*		Checks if two keys differ.
+*
+*	unsigned long long GetOrderWord(int index) const
+*		Returns a word of the Lehmer code, least significant first.
+*
+*	unsigned long long GetLayout() const
+*		Returns the layout word.
+*
+* std::hash<BoardKey>
+*	Hashes a BoardKey by mixing its words, so keys can be used in
+*	unordered containers.
+**********************************************************************/
+#ifndef BOARD_KEY_H
+#define BOARD_KEY_H
+
+#include "board.h"
+
+#include <functional>
+
+const int BOARD_KEY_ORDER_WORDS = 4;	//Words holding the Lehmer code of the cards not at home
+const int BOARD_KEY_ORDER_LIMBS = 8;	//32-bit limbs the Lehmer code is worked on in
+const int BOARD_KEY_LENGTH_BITS = 5;	//Bits for each of the first seven column lengths
+const int BOARD_KEY_FREE_SHIFT = (NUM_PLAY_CELLS - 1) * BOARD_KEY_LENGTH_BITS;	//First free cell occupancy bit
+const int BOARD_KEY_HOME_SHIFT = BOARD_KEY_FREE_SHIFT + NUM_FREE_CELLS;			//First home cell bit
+const int BOARD_KEY_HOME_BITS = 6;		//Bits for each home cell: height (low 4) and suit (high 2)
+const unsigned long long FULL_DECK_MASK = 0x3FFE3FFE3FFE3FFEULL;	//Bit set for each of the 52 card codes
+
+class BoardKey
+{
+	public:
+		//Default Ctor
+		BoardKey();
+
+		//1-Arg Overloaded Ctor
+		explicit BoardKey(const Board & board);
+
+		//Sets the key to that of a board
+		void Encode(const Board & board);
+
+		//Sets a board to the position of the key
+		void Decode(Board & board) const;
+
+		//Equality Operator
+		bool operator==(const BoardKey & rhs) const;
+
+		//Inequality Operator
+		bool operator!=(const BoardKey & rhs) const;
+
+		//Returns the given word of the Lehmer code
+		unsigned long long GetOrderWord(int index) const;
+
+		//Returns the layout word
+		unsigned long long GetLayout() const;
+
+	private:
+		//Multiply a Lehmer code by a radix and add a digit
+		static void MultiplyAdd(unsigned int value[], unsigned int radix, unsigned int digit);
+
+		//Divide a Lehmer code by a radix and return the remainder
+		static unsigned int DivideRemainder(unsigned int value[], unsigned int radix);
+
+		//Number the card among the remaining cards and remove it from them
+		static unsigned int TakeDigit(unsigned long long & remaining, const Card & card);
+
+		//Find the card of a number among the remaining cards and remove it from them
+		static Card TakeCard(unsigned long long & remaining, unsigned int digit);
+
+		//Count the cards of a card code mask
+		static int CountCards(unsigned long long mask);
+
+		unsigned long long m_order[BOARD_KEY_ORDER_WORDS];	//Lehmer code of the cards not at home
+		unsigned long long m_layout;	//Column lengths, free cell occupancy, and home cells
+};
+
+/**********************************************************************
+* Purpose:
+*	To compare two keys word by word.
+*
+* Precondition:
+*	An existing BoardKey object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the keys are identical.
+**********************************************************************/
+inline bool BoardKey::operator==(const BoardKey & rhs) const
+{
+	return m_layout == rhs.m_layout
+		&& m_order[0] == rhs.m_order[0] && m_order[1] == rhs.m_order[1]
+		&& m_order[2] == rhs.m_order[2] && m_order[3] == rhs.m_order[3];
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether two keys differ.
+*
+* Precondition:
+*	An existing BoardKey object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the keys are not identical.
+**********************************************************************/
+inline bool BoardKey::operator!=(const BoardKey & rhs) const
+{
+	return !(*this == rhs);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a word of the Lehmer code, least significant first.
+*
+* Precondition:
+*	An index from 0 to BOARD_KEY_ORDER_WORDS - 1.
+*
+* Postcondition:
+*	The word is returned.
+**********************************************************************/
+inline unsigned long long BoardKey::GetOrderWord(int index) const
+{
+	return m_order[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the layout word.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The layout word is returned.
+**********************************************************************/
+inline unsigned long long BoardKey::GetLayout() const
+{
+	return m_layout;
+}
+
+namespace std
+{
+	//Hashes a BoardKey by mixing its words
+	template <>
+	struct hash<BoardKey>
+	{
+		size_t operator()(const BoardKey & key) const
+		{
+			unsigned long long hash = Prng::Mix(key.GetLayout() + ZOBRIST_BASE);
+
+			for (int i = 0; i < BOARD_KEY_ORDER_WORDS; i++)
+				hash = Prng::Mix(hash ^ key.GetOrderWord(i));
+
+			return static_cast<size_t>(hash);
+		}
+	};
+}
+
+#endif //BOARD_KEY_H
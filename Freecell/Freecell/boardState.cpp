@@ -0,0 +1,464 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			boardState.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "boardState.h"
+
+/**********************************************************************
+* Purpose:
+*	To construct a BoardState with no cards on the board.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Every column, free cell, and home cell is empty.
+**********************************************************************/
+BoardState::BoardState()
+{
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+		m_freeCells[i] = Card(NO_CARD_CODE);
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+		m_homeCells[i] = Card(NO_CARD_CODE);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a BoardState with the cards of an existing Board.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	The state holds the same cards in the same places as the board.
+**********************************************************************/
+BoardState::BoardState(const Board & board)
+{
+	//Copy each play area column from the bottom up
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		for (int depth = 0; depth < board.GetColumnSize(i); depth++)
+			m_playArea[i] = m_playArea[i].Push(board.GetColumnCard(i, depth));
+	}
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+		m_freeCells[i] = board.isFreeCellEmpty(i) ? Card(NO_CARD_CODE) : board.GetFreeCell(i);
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+		m_homeCells[i] = (board.GetHomeCellSize(i) == 0) ? Card(NO_CARD_CODE) : board.GetHomeCellTop(i);
+}
+
+/**********************************************************************
+* Purpose:
+*	To create a Board with the cards of this state. Home cells are
+*	rebuilt from the ace up to their top card.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A Board holding the same cards in the same places is returned.
+**********************************************************************/
+Board BoardState::ToBoard() const
+{
+	Board board(Board::EMPTY_BOARD);	//Board with no cards, filled below
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		int size = m_playArea[i].Size();		//Number of cards in column
+		Card column[MAX_PLAY_CELL_CARDS];		//Cards of column, bottom first
+		PersistentStack<Card> travel = m_playArea[i];	//Walks down the column
+
+		//Collect cards from the top down, then place them bottom first
+		for (int depth = size - 1; depth >= 0; depth--)
+		{
+			column[depth] = travel.Peek();
+			travel = travel.Pop();
+		}
+
+		for (int depth = 0; depth < size; depth++)
+			board.PlaceInColumn(i, column[depth]);
+	}
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (!isFreeCellEmpty(i))
+			board.PlaceInFreeCell(i, m_freeCells[i]);
+	}
+
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		//Home cells hold one suit from the ace up to the top card
+		for (int rank = ACE; rank <= GetHomeCellSize(i); rank++)
+			board.PlaceInHomeCell(i, Card(static_cast<Rank>(rank), m_homeCells[i].GetSuit()));
+	}
+
+	return board;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether card(s) may be moved from a play area column to a
+*	different play area column, without making a new state. The rule
+*	is CheckPlayToPlay() of move.h, the same one Board uses, given the
+*	run on top of the column found by walking down it no further than
+*	the cards to move.
+*
+* Precondition:
+*	Three integers specifying the index of the column to move from,
+*	the index of the column to move to, and the number of cards to move.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+MoveStatus BoardState::CanMovePlayToPlay(int column1, int column2, int numCards) const
+{
+	PersistentStack<Card> travel = m_playArea[column1];	//Walks down the run on top of the column
+	Card bottom(NO_CARD_CODE);						//Lowest card of the run so far
+	int runLength = 0;								//Cards of the run walked so far
+
+	//Walk down the run, stopping at the number of cards to move
+	while (runLength < numCards && !travel.isEmpty() && (runLength == 0 || bottom.CanStackOn(travel.Peek())))
+	{
+		bottom = travel.Peek();
+		travel = travel.Pop();
+		runLength++;
+	}
+
+	return CheckPlayToPlay(column1, column2, numCards, CalculateMaxMovableCards(column2), m_playArea[column1].Size(),
+		runLength, bottom, ColumnTopOrNone(column2));
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the state after moving card(s) from a play area column
+*	to another play area column, if allowed. Only the two columns are
+*	changed; every other column is shared with this state.
+*
+* Precondition:
+*	Three integers specifying the index of the column to move from,
+*	the index of the column to move to, and the number of cards to move.
+*
+* Postcondition:
+*	The new state is returned if the move is allowed; else, an
+*	exception is thrown and this state is unchanged.
+**********************************************************************/
+BoardState BoardState::MovePlayToPlay(int column1, int column2, int numCards) const
+{
+	MoveStatus status = CanMovePlayToPlay(column1, column2, numCards);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	BoardState result(*this);	//New state, sharing every column
+	Card moved[MAX_PLAY_CELL_CARDS];	//Cards being moved, top of column first
+
+	//***Take card(s) from column
+
+	for (int i = 0; i < numCards; i++)
+	{
+		moved[i] = result.m_playArea[column1].Peek();
+		result.m_playArea[column1] = result.m_playArea[column1].Pop();
+	}
+
+	//***Put card(s) on column
+
+	for (int i = numCards - 1; i >= 0; i--)
+		result.m_playArea[column2] = result.m_playArea[column2].Push(moved[i]);
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the state after moving a card from a play area column to
+*	a free cell, if allowed.
+*
+* Precondition:
+*	Two integers specifying the index of the column to move from and
+*	the index of the free cell to move to.
+*
+* Postcondition:
+*	The new state is returned if the move is allowed; else, an
+*	exception is thrown.
+**********************************************************************/
+BoardState BoardState::MovePlayToFree(int column, int freeCellIndex) const
+{
+	MoveStatus status = CheckPlayToFree(ColumnTopOrNone(column), m_freeCells[freeCellIndex]);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	BoardState result(*this);	//New state, sharing every column
+
+	result.m_freeCells[freeCellIndex] = m_playArea[column].Peek();
+	result.m_playArea[column] = m_playArea[column].Pop();
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the state after moving a card from a play area column to
+*	a home cell, if allowed.
+*
+* Precondition:
+*	Two integers specifying the index of the column to move from and
+*	the index of the home cell to move to.
+*
+* Postcondition:
+*	The new state is returned if the move is allowed; else, an
+*	exception is thrown.
+**********************************************************************/
+BoardState BoardState::MovePlayToHome(int column, int homeCellIndex) const
+{
+	MoveStatus status = CheckPlayToHome(ColumnTopOrNone(column), m_homeCells[homeCellIndex]);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	BoardState result(*this);	//New state, sharing every column
+
+	result.m_homeCells[homeCellIndex] = m_playArea[column].Peek();
+	result.m_playArea[column] = m_playArea[column].Pop();
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the state after moving a card from a free cell to a play
+*	area column, if allowed.
+*
+* Precondition:
+*	Two integers specifying the index of the free cell to move from
+*	and the index of the column to move to.
+*
+* Postcondition:
+*	The new state is returned if the move is allowed; else, an
+*	exception is thrown.
+**********************************************************************/
+BoardState BoardState::MoveFreeToPlay(int freeCellIndex, int column) const
+{
+	MoveStatus status = CheckFreeToPlay(m_freeCells[freeCellIndex], ColumnTopOrNone(column));	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	BoardState result(*this);	//New state, sharing every column
+
+	result.m_playArea[column] = m_playArea[column].Push(m_freeCells[freeCellIndex]);
+	result.m_freeCells[freeCellIndex] = Card(NO_CARD_CODE);
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the state after moving a card from a free cell to a home
+*	cell, if allowed.
+*
+* Precondition:
+*	Two integers specifying the index of the free cell to move from
+*	and the index of the home cell to move to.
+*
+* Postcondition:
+*	The new state is returned if the move is allowed; else, an
+*	exception is thrown.
+**********************************************************************/
+BoardState BoardState::MoveFreeToHome(int freeCellIndex, int homeCellIndex) const
+{
+	MoveStatus status = CheckFreeToHome(m_freeCells[freeCellIndex], m_homeCells[homeCellIndex]);	//Whether the move is allowed
+
+	if (status != MOVE_OK)
+		throw Exception(MoveStatusMessage(status));
+
+	BoardState result(*this);	//New state, sharing every column
+
+	result.m_homeCells[homeCellIndex] = m_freeCells[freeCellIndex];
+	result.m_freeCells[freeCellIndex] = Card(NO_CARD_CODE);
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards in a play area column.
+*
+* Precondition:
+*	The index of a play area column.
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+int BoardState::GetColumnSize(int column) const
+{
+	return m_playArea[column].Size();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a play area column.
+*
+* Precondition:
+*	The index of a play area column that is not empty.
+*
+* Postcondition:
+*	The top card is returned.
+**********************************************************************/
+Card BoardState::GetColumnTop(int column) const
+{
+	return m_playArea[column].Peek();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a card of a play area column, counting up from the
+*	bottom card of the column.
+*
+* Precondition:
+*	The index of a play area column and a depth from 0 (bottom card)
+*	to GetColumnSize() - 1 (top card).
+*
+* Postcondition:
+*	The card at that depth is returned.
+**********************************************************************/
+Card BoardState::GetColumnCard(int column, int depth) const
+{
+	return m_playArea[column][depth];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not a free cell is empty.
+*
+* Precondition:
+*	The index of a free cell.
+*
+* Postcondition:
+*	True is returned if the free cell is empty.
+**********************************************************************/
+bool BoardState::isFreeCellEmpty(int freeCellIndex) const
+{
+	return (m_freeCells[freeCellIndex].GetCode() == NO_CARD_CODE);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the card in a free cell.
+*
+* Precondition:
+*	The index of a free cell that is not empty.
+*
+* Postcondition:
+*	The card in the free cell is returned.
+**********************************************************************/
+Card BoardState::GetFreeCell(int freeCellIndex) const
+{
+	return m_freeCells[freeCellIndex];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards in a home cell, which is the rank of
+*	its top card.
+*
+* Precondition:
+*	The index of a home cell.
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+int BoardState::GetHomeCellSize(int homeCellIndex) const
+{
+	return CARD_RANK[m_homeCells[homeCellIndex].GetCode()];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a home cell.
+*
+* Precondition:
+*	The index of a home cell that is not empty.
+*
+* Postcondition:
+*	The top card is returned.
+**********************************************************************/
+Card BoardState::GetHomeCellTop(int homeCellIndex) const
+{
+	return m_homeCells[homeCellIndex];
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if every card has been placed in the home cells.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if every home cell holds a King.
+**********************************************************************/
+bool BoardState::WonGame() const
+{
+	for (int i = 0; i < NUM_HOME_CELLS; i++)
+	{
+		if (GetHomeCellSize(i) != NUM_RANKS)
+			return false;
+	}
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To determine the maximum number of cards that can be moved at the
+*	same time from column to column, based on the number of empty free
+*	cells and empty play area columns (not counting the destination).
+*
+* Precondition:
+*	The index of the column the cards would move to.
+*
+* Postcondition:
+*	The maximum number of cards is returned.
+**********************************************************************/
+int BoardState::CalculateMaxMovableCards(int destColumn) const
+{
+	int numEmptyFreeCells = 0;	//Counts number of free cells that are empty
+	int numEmptyPlayCells = 0;	//Counts number of play area columns that are empty
+
+	for (int i = 0; i < NUM_FREE_CELLS; i++)
+	{
+		if (isFreeCellEmpty(i))
+			numEmptyFreeCells++;
+	}
+
+	for (int i = 0; i < NUM_PLAY_CELLS; i++)
+	{
+		if (i != destColumn && m_playArea[i].isEmpty())
+			numEmptyPlayCells++;
+	}
+
+	return MaxMovableCards(numEmptyFreeCells, numEmptyPlayCells);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the top card of a play area column in the form the move
+*	rules of move.h take.
+*
+* Precondition:
+*	The index of a play area column.
+*
+* Postcondition:
+*	The top card is returned, or Card(NO_CARD_CODE) if the column is
+*	empty.
+**********************************************************************/
+Card BoardState::ColumnTopOrNone(int column) const
+{
+	return m_playArea[column].isEmpty() ? Card(NO_CARD_CODE) : m_playArea[column].Peek();
+}
@@ -0,0 +1,173 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			boardState.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: BoardState
+*
+* Purpose:
+*	This class is an immutable snapshot of a Freecell board. Each play
+*	area column is a PersistentStack, so a move does not change the
+*	state it is made from: it returns a new state that shares every
+*	column the move did not touch (and the cards below the top of the
+*	columns it did touch) with the old one. Branching from a position
+*	for undo history, what-if analysis, or a search costs a few links
+*	per move, however many states are kept. Every Move* method checks
+*	its move with the Check* function of move.h that Board uses, and
+*	throws the same message Board would.
+*
+* Manager functions:
+*	BoardState()
+*		Creates a state with no cards on the board.
+*
+*	explicit BoardState(const Board & board)
+*		Creates a state with the cards of the given board.
+*
+*	BoardState(const BoardState & copy)
+*		Shares every column of copy.
+*
+*	~BoardState()
+*
+*	BoardState & operator=(const BoardState & rhs)
+*
+* Methods:
+*	Board ToBoard() const
+*		Returns a Board with the cards of this state.
+*
+*	MoveStatus CanMovePlayToPlay(int column1, int column2, int numCards) const
+*		Checks whether card(s) may be moved from a play area column to
+*		a different play area column, with CheckPlayToPlay() of move.h
+*		like Board::CanMovePlayToPlay().
+*
+*	BoardState MovePlayToPlay(int column1, int column2, int numCards) const
+*		Returns the state after moving card(s) from a play area column
+*		to a different play area column.
+*
+*	BoardState MovePlayToFree(int column, int freeCellIndex) const
+*		Returns the state after moving a card from a play area column
+*		to a free cell.
+*
+*	BoardState MovePlayToHome(int column, int homeCellIndex) const
+*		Returns the state after moving a card from a play area column
+*		to a home cell.
+*
+*	BoardState MoveFreeToPlay(int freeCellIndex, int column) const
+*		Returns the state after moving a card from a free cell to a
+*		play area column.
+*
+*	BoardState MoveFreeToHome(int freeCellIndex, int homeCellIndex) const
+*		Returns the state after moving a card from a free cell to a
+*		home cell.
+*
+*	int GetColumnSize(int column) const
+*		Returns the number of cards in a play area column.
+*
+*	Card GetColumnTop(int column) const
+*		Returns the top card of a (non-empty) play area column.
+*
+*	Card GetColumnCard(int column, int depth) const
+*		Returns the card at a depth of a play area column, counting up
+*		from the bottom card (depth 0).
+*
+*	bool isFreeCellEmpty(int freeCellIndex) const
+*		Returns true if a free cell is empty.
+*
+*	Card GetFreeCell(int freeCellIndex) const
+*		Returns the card in a (non-empty) free cell.
+*
+*	int GetHomeCellSize(int homeCellIndex) const
+*		Returns the number of cards in a home cell.
+*
+*	Card GetHomeCellTop(int homeCellIndex) const
+*		Returns the top card of a (non-empty) home cell.
+*
+*	bool WonGame() const
+*		Checks if every card is in the home cells.
+*
+*	int CalculateMaxMovableCards(int destColumn) const
+*		Determines maximum number of cards that can be moved at the
+*		same time from column to column in the play area.
+**********************************************************************/
+#ifndef BOARD_STATE_H
+#define BOARD_STATE_H
+
+#include "board.h"
+#include "persistentStack.h"
+
+class BoardState
+{
+	public:
+		//Default Ctor
+		BoardState();
+
+		//1-Arg Overloaded Ctor
+		explicit BoardState(const Board & board);
+
+		//Copy Ctor (shares every column)
+		BoardState(const BoardState & copy) = default;
+
+		//Default Dtor
+		~BoardState() = default;
+
+		//Assignment Operator (shares every column)
+		BoardState & operator=(const BoardState & rhs) = default;
+
+		//Returns a Board with the cards of this state
+		Board ToBoard() const;
+
+		//Checks whether cards may move from Play Area to Play Area
+		MoveStatus CanMovePlayToPlay(int column1, int column2, int numCards) const;
+
+		//Returns state after moving from Play Area to Play Area
+		BoardState MovePlayToPlay(int column1, int column2, int numCards) const;
+
+		//Returns state after moving from Play Area to Free Cell Area
+		BoardState MovePlayToFree(int column, int freeCellIndex) const;
+
+		//Returns state after moving from Play Area to Home Cell Area
+		BoardState MovePlayToHome(int column, int homeCellIndex) const;
+
+		//Returns state after moving from Free Cell Area to Play Area
+		BoardState MoveFreeToPlay(int freeCellIndex, int column) const;
+
+		//Returns state after moving from Free Cell Area to Home Cell Area
+		BoardState MoveFreeToHome(int freeCellIndex, int homeCellIndex) const;
+
+		//Returns the number of cards in a play area column
+		int GetColumnSize(int column) const;
+
+		//Returns the top card of a play area column
+		Card GetColumnTop(int column) const;
+
+		//Returns the card at a depth of a play area column, counting up from the bottom
+		Card GetColumnCard(int column, int depth) const;
+
+		//Returns true if a free cell is empty
+		bool isFreeCellEmpty(int freeCellIndex) const;
+
+		//Returns the card in a free cell
+		Card GetFreeCell(int freeCellIndex) const;
+
+		//Returns the number of cards in a home cell
+		int GetHomeCellSize(int homeCellIndex) const;
+
+		//Returns the top card of a home cell
+		Card GetHomeCellTop(int homeCellIndex) const;
+
+		//Check if every card is home
+		bool WonGame() const;
+
+		//Determine max number of cards to move
+		int CalculateMaxMovableCards(int destColumn) const;
+
+	private:
+		//Returns the top card of a play area column, Card(NO_CARD_CODE) if empty
+		Card ColumnTopOrNone(int column) const;
+
+		PersistentStack<Card> m_playArea[NUM_PLAY_CELLS];	//Shared stacks of Cards in Play Area
+		Card m_freeCells[NUM_FREE_CELLS];	//Cards in Free Cell Area (NO_CARD_CODE if empty)
+		Card m_homeCells[NUM_HOME_CELLS];	//Top Card of each Home Cell (NO_CARD_CODE if empty)
+};
+
+#endif //BOARD_STATE_H
@@ -0,0 +1,130 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			bounds.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: CheckedBounds
+*
+* Purpose:
+*	Bounds policy for Array, StackArray, StackFixed and StackLL that
+*	checks every index, push, pop and peek and throws an Exception
+*	when it is out of range. This is how the containers always behaved
+*	and is the default in debug builds.
+*
+* Class: AssertBounds
+*
+* Purpose:
+*	Bounds policy that checks with assert(), so a debug build stops at
+*	the first bad access and a build with NDEBUG does no checking.
+*
+* Class: UncheckedBounds
+*
+* Purpose:
+*	Bounds policy that does no checking, so inner loops have no extra
+*	branches. The caller must make sure every access is in range. This
+*	is the default in optimized builds.
+*
+* Bounds policy methods:
+*	static void Check(bool inRange, char * msg)
+*		Handles an access that may be out of range; msg is the message
+*		of the Exception CheckedBounds throws.
+*
+* DefaultBounds:
+*	The policy containers use when none is given. Define one of
+*	FREECELL_BOUNDS_CHECKED, FREECELL_BOUNDS_ASSERT or
+*	FREECELL_BOUNDS_UNCHECKED to choose it; otherwise it is
+*	CheckedBounds when _DEBUG is defined and UncheckedBounds when it
+*	is not.
+**********************************************************************/
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include "exception.h"
+
+#include <cassert>
+
+class CheckedBounds
+{
+public:
+	//Throws an Exception if the access is out of range
+	static void Check(bool inRange, char * msg);
+};
+
+class AssertBounds
+{
+public:
+	//Asserts that the access is in range
+	static void Check(bool inRange, char * msg);
+};
+
+class UncheckedBounds
+{
+public:
+	//Does nothing (the compiler removes the check entirely)
+	static void Check(bool inRange, char * msg);
+};
+
+/**********************************************************************
+* Purpose:
+*	To throw an Exception with the given message if an access is out
+*	of range.
+*
+* Precondition:
+*	Whether the access is in range and the message to throw if not.
+*
+* Postcondition:
+*	An Exception is thrown if the access is out of range.
+**********************************************************************/
+inline void CheckedBounds::Check(bool inRange, char * msg)
+{
+	if (!inRange)
+		throw Exception(msg);
+}
+
+/**********************************************************************
+* Purpose:
+*	To assert that an access is in range.
+*
+* Precondition:
+*	Whether the access is in range and a message (unused).
+*
+* Postcondition:
+*	The program stops if the access is out of range and NDEBUG is not
+*	defined.
+**********************************************************************/
+inline void AssertBounds::Check(bool inRange, char * msg)
+{
+	(void)msg;
+	assert(inRange);
+}
+
+/**********************************************************************
+* Purpose:
+*	To skip checking an access.
+*
+* Precondition:
+*	Whether the access is in range and a message (both unused).
+*
+* Postcondition:
+*	<None>
+**********************************************************************/
+inline void UncheckedBounds::Check(bool inRange, char * msg)
+{
+	(void)inRange;
+	(void)msg;
+}
+
+#if defined(FREECELL_BOUNDS_CHECKED)
+typedef CheckedBounds DefaultBounds;
+#elif defined(FREECELL_BOUNDS_ASSERT)
+typedef AssertBounds DefaultBounds;
+#elif defined(FREECELL_BOUNDS_UNCHECKED)
+typedef UncheckedBounds DefaultBounds;
+#elif defined(_DEBUG)
+typedef CheckedBounds DefaultBounds;
+#else
+typedef UncheckedBounds DefaultBounds;
+#endif
+
+#endif //BOUNDS_H
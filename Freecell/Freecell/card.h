@@ -7,7 +7,10 @@
 * Class: Card
 *
 * Purpose:
-*	This class simulates a single playing card.
+*	This class simulates a single playing card. The rank and suit are
+*	packed into a single byte (suit in the high nibble, rank in the low
+*	nibble), so any question about a card is a single lookup in one of
+*	the constexpr tables below instead of arithmetic on the enums.
 *
 * Manager functions:
 *	Card()
@@ -18,6 +21,9 @@
 *		Creates a Card in which the rank and suit are both set to the
 *		values of the parameters.
 *
+*	explicit Card(unsigned char code)
+*		Creates a Card from its packed one-byte code.
+*
 *	Card(const Card & copy)
 *
 *	~Card()
@@ -25,7 +31,11 @@
 *	Card & operator=(const Card & rhs)
 *
 * Methods:
-*	bool operator!=(const Card & rhs)
+*	bool operator==(const Card & rhs) const
+*		Overloads the == operator so two Cards' ranks and suits can be
+*		compared.
+*
+*	bool operator!=(const Card & rhs) const
 *		Overloads the != operator so two Cards' ranks and suits can be
 *		compared.
 *
@@ -40,6 +50,20 @@
 *
 *	Suit GetSuit() const
 *		Returns the suit of the card.
+*
+*	Color GetColor() const
+*		Returns the color of the card's suit.
+*
+*	unsigned char GetCode() const
+*		Returns the packed one-byte code of the card.
+*
+*	bool CanStackOn(const Card & below) const
+*		Returns true if the card may be placed on top of the given card
+*		in the play area (one rank lower and the opposite color).
+*
+*	bool CanGoHomeAfter(const Card & top) const
+*		Returns true if the card may be placed on top of the given card
+*		in a home cell (one rank higher and the same suit).
 **********************************************************************/
 #ifndef CARD_H
 #define CARD_H
@@ -48,9 +72,81 @@
 enum Rank { ACE = 1, DEUCE, TREY, FOUR, FIVE, SIX, SEVEN, EIGHT, NINE, TEN, JACK, QUEEN, KING };
 enum Suit { SPADE, HEART, CLUB, DIAMOND };
 
+//Black suits (spade, club) and red suits (heart, diamond) alternate in the Suit enum
+enum Color { BLACK, RED };
+
 const int NUM_RANKS = 13;	//Number of possible ranks for any given card
 const int NUM_SUITS = 4;	//Number of possible suits for any given card
 
+const int NUM_CARD_CODES = 64;			//Number of possible packed card codes (4 suits * 16 rank slots)
+const unsigned char NO_CARD_CODE = 0;	//Code with rank zero, never used by a real card
+const unsigned char BAD_CARD_CODE = 0xFF;	//Marks table entries for codes that are not real cards
+
+//Rank of each packed card code (zero for codes that are not real cards)
+constexpr unsigned char CARD_RANK[NUM_CARD_CODES] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0
+};
+
+//Suit of each packed card code
+constexpr unsigned char CARD_SUIT[NUM_CARD_CODES] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3
+};
+
+//Color of each packed card code
+constexpr unsigned char CARD_COLOR[NUM_CARD_CODES] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+//Bit mask of the card codes each card code can be stacked on in the play area
+//(bit n set means the card may be placed on the card with code n)
+constexpr unsigned long long CARD_STACK_MASK[NUM_CARD_CODES] =
+{
+	0x0000000000000000ULL, 0x0004000000040000ULL, 0x0008000000080000ULL, 0x0010000000100000ULL,
+	0x0020000000200000ULL, 0x0040000000400000ULL, 0x0080000000800000ULL, 0x0100000001000000ULL,
+	0x0200000002000000ULL, 0x0400000004000000ULL, 0x0800000008000000ULL, 0x1000000010000000ULL,
+	0x2000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000400000004ULL, 0x0000000800000008ULL, 0x0000001000000010ULL,
+	0x0000002000000020ULL, 0x0000004000000040ULL, 0x0000008000000080ULL, 0x0000010000000100ULL,
+	0x0000020000000200ULL, 0x0000040000000400ULL, 0x0000080000000800ULL, 0x0000100000001000ULL,
+	0x0000200000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0004000000040000ULL, 0x0008000000080000ULL, 0x0010000000100000ULL,
+	0x0020000000200000ULL, 0x0040000000400000ULL, 0x0080000000800000ULL, 0x0100000001000000ULL,
+	0x0200000002000000ULL, 0x0400000004000000ULL, 0x0800000008000000ULL, 0x1000000010000000ULL,
+	0x2000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000400000004ULL, 0x0000000800000008ULL, 0x0000001000000010ULL,
+	0x0000002000000020ULL, 0x0000004000000040ULL, 0x0000008000000080ULL, 0x0000010000000100ULL,
+	0x0000020000000200ULL, 0x0000040000000400ULL, 0x0000080000000800ULL, 0x0000100000001000ULL,
+	0x0000200000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL
+};
+
+//Code of the card each card code must be placed on in a home cell
+//(NO_CARD_CODE for aces, which start an empty home cell)
+constexpr unsigned char CARD_HOME_PARENT[NUM_CARD_CODES] =
+{
+	0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xFF, 0xFF,
+	0xFF, 0x00, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0xFF, 0xFF,
+	0xFF, 0x00, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0xFF, 0xFF,
+	0xFF, 0x00, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0xFF, 0xFF
+};
+
+//Packs a rank and suit into a card code
+constexpr unsigned char MakeCardCode(Rank rank, Suit suit)
+{
+	return static_cast<unsigned char>((suit << 4) | rank);
+}
+
 class Card
 {
 public:
@@ -60,17 +156,23 @@ public:
 	//2-Arg Overloaded Ctor
 	Card(Rank rank, Suit suit);
 
-	//Copy Ctor
-	Card(const Card & copy);
+	//1-Arg Overloaded Ctor
+	explicit Card(unsigned char code);
+
+	//Copy Ctor (trivial, so Cards can be copied as raw bytes)
+	Card(const Card & copy) = default;
 
 	//Default Destructor
-	~Card();
+	~Card() = default;
 
 	//Assignment Operator
-	Card & operator=(const Card & rhs);
+	Card & operator=(const Card & rhs) = default;
+
+	//Overloaded == Operator
+	bool operator==(const Card & rhs) const;
 
 	//Overloaded != Operator
-	bool operator!=(const Card & rhs);
+	bool operator!=(const Card & rhs) const;
 
 	//Setter for m_rank
 	void SetRank(Rank rank);
@@ -84,9 +186,146 @@ public:
 	//Getter for m_suit
 	Suit GetSuit() const;
 
+	//Returns color of the suit
+	Color GetColor() const;
+
+	//Getter for m_code
+	unsigned char GetCode() const;
+
+	//Checks if card can be placed on another card in the play area
+	bool CanStackOn(const Card & below) const;
+
+	//Checks if card can be placed on another card in a home cell
+	bool CanGoHomeAfter(const Card & top) const;
+
 private:
-	Rank m_rank;	//Stores Card rank
-	Suit m_suit;	//Stores Card suit
+	unsigned char m_code;	//Stores Card suit (high nibble) and rank (low nibble)
 };
 
+/**********************************************************************
+* Purpose:
+*	To overload the == operator in order to compare the ranks and suits
+*	of two Cards.
+*
+* Precondition:
+*	An existing Card object passed by const ref.
+*
+* Postcondition:
+*	True is returned if both Cards have the same rank and suit.
+**********************************************************************/
+inline bool Card::operator==(const Card & rhs) const
+{
+	return (m_code == rhs.m_code);
+}
+
+/**********************************************************************
+* Purpose:
+*	To overload the != operator in order to compare the ranks and suits
+*	of two Cards.
+*
+* Precondition:
+*	An existing Card object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the Cards differ in rank or suit.
+**********************************************************************/
+inline bool Card::operator!=(const Card & rhs) const
+{
+	return (m_code != rhs.m_code);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the value of the rank.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The rank is returned.
+**********************************************************************/
+inline Rank Card::GetRank() const
+{
+	return static_cast<Rank>(CARD_RANK[m_code]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the value of the suit.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The suit is returned.
+**********************************************************************/
+inline Suit Card::GetSuit() const
+{
+	return static_cast<Suit>(CARD_SUIT[m_code]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the color of the suit.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The color is returned.
+**********************************************************************/
+inline Color Card::GetColor() const
+{
+	return static_cast<Color>(CARD_COLOR[m_code]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the packed one-byte code of the card.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The code is returned.
+**********************************************************************/
+inline unsigned char Card::GetCode() const
+{
+	return m_code;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether the card may be placed on top of another card in
+*	the play area.
+*
+* Precondition:
+*	The Card that would be underneath, passed by const ref.
+*
+* Postcondition:
+*	True is returned if the card is one rank lower than, and the
+*	opposite color of, the card underneath.
+**********************************************************************/
+inline bool Card::CanStackOn(const Card & below) const
+{
+	return ((CARD_STACK_MASK[m_code] >> below.m_code) & 1) != 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether the card may be placed on top of another card in
+*	a home cell.
+*
+* Precondition:
+*	The Card currently on top of the home cell, passed by const ref.
+*
+* Postcondition:
+*	True is returned if the card is one rank higher than, and the same
+*	suit as, the card on top of the home cell.
+**********************************************************************/
+inline bool Card::CanGoHomeAfter(const Card & top) const
+{
+	return (CARD_HOME_PARENT[m_code] == top.m_code);
+}
+
 #endif //CARD_H
\ No newline at end of file
@@ -0,0 +1,320 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			dealBuffer.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "dealBuffer.h"
+
+#include <cstring>
+using std::memcpy;
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a DealBuffer with no room for deals.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+DealBuffer::DealBuffer() : m_capacity(0), m_numDeals(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a DealBuffer with room for the given
+*	number of deals. The Array's length is an int, so the capacity is
+*	checked before the number of card codes is computed.
+*
+* Precondition:
+*	An integer representing the number of deals to make room for, from
+*	0 to DEAL_BUFFER_MAX_CAPACITY.
+*
+* Postcondition:
+*	The buffer has room for the given number of deals and holds none,
+*	only if the capacity is in range; else, an exception is thrown.
+**********************************************************************/
+DealBuffer::DealBuffer(int capacity) : m_capacity(0), m_numDeals(0)
+{
+	if (capacity < 0 || capacity > DEAL_BUFFER_MAX_CAPACITY)
+		throw Exception("ERROR: Deal buffer capacity out of range.");
+
+	m_cards.resize(capacity * NUM_CARDS_DECK);
+	m_capacity = capacity;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a DealBuffer with data members whose
+*	initial values are copied from data members of an existing
+*	DealBuffer object.
+*
+* Precondition:
+*	An existing DealBuffer object passed by const ref.
+*
+* Postcondition:
+*	The data members are initialized to the values of the data members
+*	of the existing DealBuffer object.
+**********************************************************************/
+DealBuffer::DealBuffer(const DealBuffer & copy) : m_cards(copy.m_cards),
+m_capacity(copy.m_capacity), m_numDeals(copy.m_numDeals)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To destroy the DealBuffer and reset the data members to default
+*	values.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are reset to default values.
+**********************************************************************/
+DealBuffer::~DealBuffer()
+{
+	//Reset to default values
+	m_capacity = 0;
+	m_numDeals = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To assign one existing DealBuffer object to another existing
+*	DealBuffer object by copying values of data members from one to
+*	another.
+*
+* Precondition:
+*	An existing DealBuffer object passed by const ref.
+*
+* Postcondition:
+*	One existing DealBuffer object is assigned to another existing
+*	DealBuffer object.
+**********************************************************************/
+DealBuffer & DealBuffer::operator=(const DealBuffer & rhs)
+{
+	//Check for self-assignment
+	if (this != &rhs)
+	{
+		m_cards = rhs.m_cards;	//Use Array's assignment operator
+		m_capacity = rhs.m_capacity;
+		m_numDeals = rhs.m_numDeals;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To fill the buffer with the classic numbered deals, DEAL_LANES
+*	games at a time. Each lane runs its own copy of the numbered deal
+*	generator; the random values and draw indices for all lanes are
+*	computed in one pass (which the compiler can vectorize), and the
+*	modulo is replaced with a multiply by a reciprocal that is exact
+*	for the 16-bit values the generator returns.
+*
+* Precondition:
+*	The first game number and the number of deals to generate, which
+*	must not be more than the capacity.
+*
+* Postcondition:
+*	The buffer holds the numbered deals, and deal i matches
+*	Deck::DealGameNumber(firstGameNumber + i).
+**********************************************************************/
+void DealBuffer::FillGameNumbers(unsigned int firstGameNumber, int numDeals)
+{
+	if (numDeals < 0 || numDeals > m_capacity)
+		throw Exception("ERROR: Not enough room in deal buffer for that many deals.");
+
+	unsigned char sequential[NUM_CARDS_DECK];	//Sequential deck that cards are drawn from
+
+	//Fill sequential deck in the order the numbered deals expect
+	for (int i = 0; i < NUM_CARDS_DECK; i++)
+		sequential[i] = MakeCardCode(static_cast<Rank>(i / NUM_SUITS + 1), GAME_NUMBER_SUITS[i % NUM_SUITS]);
+
+	for (int first = 0; first < numDeals; first += DEAL_LANES)
+	{
+		unsigned int seed[DEAL_LANES];		//Generator state of each lane
+		unsigned int highBit[DEAL_LANES];	//Extended range marker of each lane
+		unsigned int draw[DEAL_LANES];		//Index drawn by each lane this step
+		unsigned char source[DEAL_LANES][NUM_CARDS_DECK];	//Cards remaining in each lane
+		int numLanes = (numDeals - first < DEAL_LANES) ? numDeals - first : DEAL_LANES;
+
+		for (int lane = 0; lane < DEAL_LANES; lane++)
+		{
+			seed[lane] = firstGameNumber + static_cast<unsigned int>(first + lane);
+			highBit[lane] = (seed[lane] >= GAME_NUMBER_HIGH_RANGE) ? 0x8000 : 0;
+			memcpy(source[lane], sequential, NUM_CARDS_DECK);
+		}
+
+		//Draw each card from the cards that remain
+		for (int cardsLeft = NUM_CARDS_DECK; cardsLeft > 0; cardsLeft--)
+		{
+			unsigned long long reciprocal = (0x100000000ULL / cardsLeft) + 1;	//Exact for values below 2^16
+			unsigned char * row = &m_cards[0] + static_cast<size_t>(NUM_CARDS_DECK - cardsLeft) * m_capacity;
+
+			//Advance every lane's generator and find its draw index
+			for (int lane = 0; lane < DEAL_LANES; lane++)
+			{
+				seed[lane] = seed[lane] * GAME_NUMBER_MULTIPLIER + GAME_NUMBER_INCREMENT;
+
+				unsigned int random = ((seed[lane] >> 16) & 0x7FFF) | highBit[lane];
+				unsigned int quotient = static_cast<unsigned int>((random * reciprocal) >> 32);
+
+				draw[lane] = random - quotient * cardsLeft;
+			}
+
+			//Deal drawn card and fill its slot with last remaining card
+			for (int lane = 0; lane < numLanes; lane++)
+			{
+				row[first + lane] = source[lane][draw[lane]];
+				source[lane][draw[lane]] = source[lane][cardsLeft - 1];
+			}
+		}
+	}
+
+	m_numDeals = numDeals;
+}
+
+/**********************************************************************
+* Purpose:
+*	To fill the buffer with random deals, DEAL_LANES deals at a time.
+*	Each random value is a splitmix64 hash of the seed, the deal index
+*	and the step, so lanes share no state, the per-lane arithmetic can
+*	be vectorized, and a deal does not depend on which lane made it.
+*	Each lane runs a Fisher-Yates shuffle of the sequential deck.
+*
+* Precondition:
+*	A seed and the number of deals to generate, which must not be
+*	more than the capacity.
+*
+* Postcondition:
+*	The buffer holds the random deals.
+**********************************************************************/
+void DealBuffer::FillSeeded(unsigned long long seed, int numDeals)
+{
+	if (numDeals < 0 || numDeals > m_capacity)
+		throw Exception("ERROR: Not enough room in deal buffer for that many deals.");
+
+	unsigned char sequential[NUM_CARDS_DECK];	//Sequential deck (same order as Deck)
+
+	//Fill sequential deck by rank, then suit
+	for (int i = 0; i < NUM_CARDS_DECK; i++)
+		sequential[i] = MakeCardCode(static_cast<Rank>(i / NUM_SUITS + 1), static_cast<Suit>(i % NUM_SUITS));
+
+	for (int first = 0; first < numDeals; first += DEAL_LANES)
+	{
+		unsigned long long counter[DEAL_LANES];	//Stream position of each lane
+		unsigned int draw[DEAL_LANES];			//Index drawn by each lane this step
+		unsigned char deck[DEAL_LANES][NUM_CARDS_DECK];	//Deck being shuffled in each lane
+		int numLanes = (numDeals - first < DEAL_LANES) ? numDeals - first : DEAL_LANES;
+
+		for (int lane = 0; lane < DEAL_LANES; lane++)
+		{
+			//Give each deal its own stream of NUM_CARDS_DECK values
+			counter[lane] = seed + static_cast<unsigned long long>(first + lane) * NUM_CARDS_DECK * 0x9E3779B97F4A7C15ULL;
+			memcpy(deck[lane], sequential, NUM_CARDS_DECK);
+		}
+
+		//Swap each card with a random card at or below it, finishing one position per step
+		for (int i = NUM_CARDS_DECK - 1; i >= 0; i--)
+		{
+			unsigned char * row = &m_cards[0] + static_cast<size_t>(i) * m_capacity;
+
+			//Advance every lane's stream and find its swap index
+			for (int lane = 0; lane < DEAL_LANES; lane++)
+			{
+				counter[lane] += 0x9E3779B97F4A7C15ULL;
+
+				unsigned long long mixed = counter[lane];	//splitmix64 output for this step
+				mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+				mixed ^= (mixed >> 31);
+
+				draw[lane] = static_cast<unsigned int>(((mixed >> 32) * (i + 1)) >> 32);
+			}
+
+			//Swap and deal the card that is now final at this position
+			for (int lane = 0; lane < numLanes; lane++)
+			{
+				unsigned char temp = deck[lane][i];
+				deck[lane][i] = deck[lane][draw[lane]];
+				deck[lane][draw[lane]] = temp;
+
+				row[first + lane] = deck[lane][i];
+			}
+		}
+	}
+
+	m_numDeals = numDeals;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the card dealt at the given position of a deal.
+*
+* Precondition:
+*	The index of a deal in the buffer and a position from 0 to 51.
+*
+* Postcondition:
+*	The card is returned.
+**********************************************************************/
+Card DealBuffer::GetCard(int deal, int position) const
+{
+	if (deal < 0 || deal >= m_numDeals)
+		throw Exception("ERROR: Deal index out of range.");
+
+	return Card(GetPosition(position)[deal]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the card codes of every deal at the given position. The
+*	codes of deal i are at index i of the returned row.
+*
+* Precondition:
+*	A position from 0 to 51.
+*
+* Postcondition:
+*	A pointer to m_capacity card codes is returned.
+**********************************************************************/
+const unsigned char * DealBuffer::GetPosition(int position) const
+{
+	if (position < 0 || position >= NUM_CARDS_DECK)
+		throw Exception("ERROR: Deal position out of range.");
+
+	return &m_cards[0] + static_cast<size_t>(position) * m_capacity;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of deals currently in the buffer.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of deals is returned.
+**********************************************************************/
+int DealBuffer::GetNumDeals() const
+{
+	return m_numDeals;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of deals the buffer has room for.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The capacity is returned.
+**********************************************************************/
+int DealBuffer::GetCapacity() const
+{
+	return m_capacity;
+}
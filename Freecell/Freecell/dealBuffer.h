@@ -0,0 +1,114 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			dealBuffer.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: DealBuffer
+*
+* Purpose:
+*	This class generates many starting deals at once into one flat
+*	buffer, without building a Deck or Board for each deal. Each card
+*	is stored as its one-byte Card code, and the buffer is laid out
+*	position by position (structure of arrays): all deals' first
+*	cards, then all deals' second cards, and so on. Position p is the
+*	p-th card dealt, which Board::CreateBoard places in column p % 8,
+*	row p / 8.
+*
+*	Deals are generated DEAL_LANES at a time with one independent
+*	random number stream per lane, so the per-lane arithmetic can be
+*	vectorized by the compiler.
+*
+* Manager functions:
+*	DealBuffer()
+*		Creates a DealBuffer with no room for any deals.
+*
+*	DealBuffer(int capacity)
+*		Creates a DealBuffer with room for the given number of deals,
+*		up to DEAL_BUFFER_MAX_CAPACITY (about 41 million). Larger
+*		corpora must be filled and consumed in batches of at most that
+*		many deals, for example with FillGameNumbers() on successive
+*		ranges of game numbers.
+*
+*	DealBuffer(const DealBuffer & copy)
+*
+*	~DealBuffer()
+*
+*	DealBuffer & operator=(const DealBuffer & rhs)
+*
+* Methods:
+*	void FillGameNumbers(unsigned int firstGameNumber, int numDeals)
+*		Fills the buffer with the classic numbered deals starting at
+*		firstGameNumber. Deal i matches Deck::DealGameNumber() for game
+*		number firstGameNumber + i.
+*
+*	void FillSeeded(unsigned long long seed, int numDeals)
+*		Fills the buffer with random deals. Deal i depends only on the
+*		seed and i, so the same seed always produces the same deals.
+*
+*	Card GetCard(int deal, int position) const
+*		Returns the card dealt at the given position of a deal.
+*
+*	const unsigned char * GetPosition(int position) const
+*		Returns the card codes of every deal at the given position.
+*
+*	int GetNumDeals() const
+*		Returns the number of deals currently in the buffer.
+*
+*	int GetCapacity() const
+*		Returns the number of deals the buffer has room for.
+**********************************************************************/
+#ifndef DEAL_BUFFER_H
+#define DEAL_BUFFER_H
+
+#include "array.h"
+#include "deck.h"
+
+#include <climits>
+
+const int DEAL_LANES = 8;	//Number of deals generated side by side
+const int DEAL_BUFFER_MAX_CAPACITY = INT_MAX / NUM_CARDS_DECK;	//Most deals whose cards fit in one Array
+
+class DealBuffer
+{
+public:
+	//Default Ctor
+	DealBuffer();
+
+	//1-Arg Overloaded Ctor
+	DealBuffer(int capacity);
+
+	//Copy Ctor
+	DealBuffer(const DealBuffer & copy);
+
+	//Default Dtor
+	~DealBuffer();
+
+	//Assignment Operator
+	DealBuffer & operator=(const DealBuffer & rhs);
+
+	//Fills buffer with classic numbered deals
+	void FillGameNumbers(unsigned int firstGameNumber, int numDeals);
+
+	//Fills buffer with seeded random deals
+	void FillSeeded(unsigned long long seed, int numDeals);
+
+	//Returns card at a position of a deal
+	Card GetCard(int deal, int position) const;
+
+	//Returns card codes of every deal at a position
+	const unsigned char * GetPosition(int position) const;
+
+	//Getter for m_numDeals
+	int GetNumDeals() const;
+
+	//Getter for m_capacity
+	int GetCapacity() const;
+
+private:
+	Array<unsigned char> m_cards;	//Card codes, NUM_CARDS_DECK rows of m_capacity deals
+	int m_capacity;					//Number of deals the buffer has room for
+	int m_numDeals;					//Number of deals currently in the buffer
+};
+
+#endif //DEAL_BUFFER_H
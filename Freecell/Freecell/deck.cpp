@@ -7,11 +7,6 @@
 
 #include "deck.h"
 
-#include <cstdlib>
-#include <ctime>
-using std::srand;
-using std::time;
-
 /**********************************************************************
 * Purpose:
 *	To construct an instance of an Deck and initialize the data
@@ -27,151 +22,111 @@ using std::time;
 **********************************************************************/
 Deck::Deck() : m_current_card(0)
 {
-	int count = 0;	//Counter for loop that initializes cards in deck
-
-	//Initialize each Card to different rank/suit combination
-	for (int row = 1; row <= NUM_RANKS; row++)
-	{
-		for (int column = 0; column < NUM_SUITS; column++)
-		{
-			m_deck[count].SetRank(static_cast<Rank>(row));
-			m_deck[count].SetSuit(static_cast<Suit>(column));
-			count++;
-		}
-	}
-
-	//Placed here instead of in Shuffle() b/c needs only run once
-	srand((unsigned int)time(NULL));
+	ResetOrder();
 }
 
 /**********************************************************************
 * Purpose:
-*	To construct an instance of an Deck with data members whose
-*	initial values are copied from data members of an existing Deck
-*	object.
+*	To randomly reorder all 52 cards in the deck using the calling
+*	thread's own generator, so concurrent shuffles never share state.
 *
 * Precondition:
-*	An existing Deck object passed by const ref.
+*	<None>
 *
 * Postcondition:
-*	The data members are initialized to the values of the data members
-*	of the existing Deck object.
+*	The cards in the deck are randomly shuffled and the current card
+*	is reset to the first card in the deck.
 **********************************************************************/
-Deck::Deck(const Deck & copy) : m_current_card(0)
+void Deck::Shuffle()
 {
-	*this = copy;	//Use assignment operator
+	Shuffle(Prng::ThreadLocal());
 }
 
 /**********************************************************************
 * Purpose:
-*	To destroy the Deck and reset the data members to default values.
+*	To arrange the deck in the order of the classic numbered deal with
+*	the given game number. Cards are drawn from a sequential deck (by
+*	rank, then clubs, diamonds, hearts, spades) with the same linear
+*	congruential generator the original game used, and the drawn slot
+*	is refilled with the last remaining card. Also resets the current
+*	card back to the top of the deck.
 *
 * Precondition:
-*	<None>
+*	A game number. Numbers of 2^31 and above use the extended range,
+*	which sets bit 15 of every random value.
 *
 * Postcondition:
-*	Data members are reset to default values.
+*	The cards are in the order of the numbered deal and the current
+*	card is the first card in the deck.
 **********************************************************************/
-Deck::~Deck()
+void Deck::DealGameNumber(unsigned int gameNumber)
 {
-	//Reset to default value
+	Card source[NUM_CARDS_DECK];	//Sequential deck that cards are drawn from
+	unsigned int seed = gameNumber;	//State of the generator
+	unsigned int highBit = (gameNumber >= GAME_NUMBER_HIGH_RANGE) ? 0x8000 : 0;	//Extended range marker
+
+	//Fill sequential deck in the order the numbered deals expect
+	for (int i = 0; i < NUM_CARDS_DECK; i++)
+		source[i] = Card(static_cast<Rank>(i / NUM_SUITS + 1), GAME_NUMBER_SUITS[i % NUM_SUITS]);
+
+	//Draw each card from the cards that remain
+	for (int cardsLeft = NUM_CARDS_DECK; cardsLeft > 0; cardsLeft--)
+	{
+		seed = seed * GAME_NUMBER_MULTIPLIER + GAME_NUMBER_INCREMENT;
+
+		unsigned int random = ((seed >> 16) & 0x7FFF) | highBit;	//Value the original rand() returned
+		int j = static_cast<int>(random % cardsLeft);
+
+		m_deck[NUM_CARDS_DECK - cardsLeft] = source[j];
+		source[j] = source[cardsLeft - 1];	//Fill drawn slot with last remaining card
+	}
+
+	//Reset current card to first card in deck
 	m_current_card = 0;
 }
 
 /**********************************************************************
 * Purpose:
-*	To assign one existing Deck object to another existing Deck object
-*	by copying values of data members from one to another.
+*	To deal one of the 52 cards in the deck, and then increment the
+*	current card to the next card in the deck.
 *
 * Precondition:
-*	An existing Deck object passed by const ref.
+*	<None>
 *
 * Postcondition:
-*	One existing Deck object is assigned to another existing Deck
-*	object.
+*	The current card is returned from the deck.
 **********************************************************************/
-Deck & Deck::operator=(const Deck & rhs)
+Card Deck::Deal()
 {
-	//Check for self-assignment
-	if (this != &rhs)
-	{
-		m_current_card = rhs.m_current_card;
-		
-		for (int i = 0; i < NUM_CARDS_DECK; i++)
-		{
-			m_deck[i] = rhs.m_deck[i];	//Use Card's assignment operator
-		}
-	}
-
-	return *this;
+	//Retrun current card in deck, then increment current card to next card in deck
+	return m_deck[m_current_card++];
 }
 
 /**********************************************************************
 * Purpose:
-*	To randomly assign different combinations of ranks and suits to all
-*	52 cards in the deck. Also resets the current card back to the top
-*	of the deck.
+*	To put all 52 cards back in sequential order (by rank, then suit),
+*	and reset the current card back to the top of the deck.
 *
 * Precondition:
 *	<None>
 *
 * Postcondition:
-*	The cards in the deck are randomly shuffled and the current card
-*	is reset to the first card in the deck.
+*	The cards are in sequential order and the current card is the
+*	first card in the deck.
 **********************************************************************/
-void Deck::Shuffle()
+void Deck::ResetOrder()
 {
-	Rank rank = ACE;		//To hold value of random rank
-	Suit suit = SPADE;		//To hold value of random suit
-	int numCards = 0;		//To count number of randomized cards
-	bool sameCard = false;	//Flags whether rank and suit combo already exists
+	int count = 0;	//Counter for loop that initializes cards in deck
 
-	//While not all cards have been assigned a rank and suit combo
-	while (numCards < NUM_CARDS_DECK)
+	//Initialize each Card to different rank/suit combination
+	for (int row = 1; row <= NUM_RANKS; row++)
 	{
-		sameCard = false;	
-
-		int rankInt = (rand() % NUM_RANKS) + 1;	//Add one, since Rank skips zero and starts at 1
-		rank = static_cast<Rank>(rankInt);		//Randomly generate a rank
-		suit = static_cast<Suit>(rand() % NUM_SUITS);	//Randomly generate a suit
-
-		//For all cards that have been assigned a rank and suit combo
-		for (int i = 0; i < numCards && sameCard == false; i++)
-		{
-			//Check if the random rank and suit combo already exists
-			if (m_deck[i].GetRank() == rank && m_deck[i].GetSuit() == suit)
-			{
-				sameCard = true;
-			}
-		}
-
-		//If new rank and suit combo
-		if (sameCard == false)
+		for (int column = 0; column < NUM_SUITS; column++)
 		{
-			//Assign next card in deck that rank and suit combo
-			m_deck[numCards].SetRank(rank);
-			m_deck[numCards].SetSuit(suit);
-			numCards++;
+			m_deck[count] = Card(static_cast<Rank>(row), static_cast<Suit>(column));
+			count++;
 		}
 	}
 
-	//Reset current card to first card in deck
 	m_current_card = 0;
-}
-
-/**********************************************************************
-* Purpose:
-*	To deal one of the 52 cards in the deck, and then increment the
-*	current card to the next card in the deck.
-*
-* Precondition:
-*	<None>
-*
-* Postcondition:
-*	The current card is returned from the deck.
-**********************************************************************/
-Card Deck::Deal()
-{
-	//Retrun current card in deck, then increment current card to next card in deck
-	return m_deck[m_current_card++];
 }
\ No newline at end of file
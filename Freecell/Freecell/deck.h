@@ -15,6 +15,9 @@
 *		rank and suit combination in sequential order.
 *
 *	Deck(const Deck & copy)
+*		Copies the deck. The cards are stored inline, so this is a
+*		flat copy with no allocation, and moving a Deck (or swapping
+*		two with std::swap) is the same flat copy.
 *
 *	~Deck()
 *
@@ -22,8 +25,20 @@
 *
 * Methods:
 *	void Shuffle()
-*		Randomly assigns different combinations of ranks and suits to
-*		all 52 cards in the deck.
+*		Randomly reorders all 52 cards in the deck using the calling
+*		thread's own random number generator.
+*
+*	template <typename Generator> void Shuffle(Generator & generator)
+*		Randomly reorders all 52 cards in the deck using the given
+*		generator, which must provide an unsigned long long Next()
+*		method (such as Prng). The same generator state always produces
+*		the same deal.
+*
+*	void DealGameNumber(unsigned int gameNumber)
+*		Arranges the deck in the order of the classic numbered deal
+*		with the given game number, so the board dealt from it matches
+*		the standard FreeCell game numbering (1 to 32000, and the
+*		extended range up to 2^32 - 1).
 *
 *	Card Deal()
 *		Deals one of the 52 cards in the deck.
@@ -32,33 +47,87 @@
 #define DECK_H
 
 #include "card.h"
+#include "prng.h"
 
 const int NUM_CARDS_DECK = 52;	//Number of cards in a deck
 
+//Linear congruential generator used by the classic numbered deals
+const unsigned int GAME_NUMBER_MULTIPLIER = 214013;
+const unsigned int GAME_NUMBER_INCREMENT = 2531011;
+const unsigned int GAME_NUMBER_HIGH_RANGE = 0x80000000;	//Game numbers from here on set bit 15 of every random value
+
+//Suit order of the sequential deck the classic numbered deals draw from
+const Suit GAME_NUMBER_SUITS[NUM_SUITS] = { CLUB, DIAMOND, HEART, SPADE };
+
 class Deck
 {
 public:
 	//Default Ctor
 	Deck();
 
-	//Copy Ctor
-	Deck(const Deck & copy);
+	//Copy Ctor (trivial, cards are stored inline)
+	Deck(const Deck & copy) = default;
 
 	//Default Dtor
-	~Deck();
+	~Deck() = default;
 
 	//Assignment Operator
-	Deck & operator=(const Deck & rhs);
+	Deck & operator=(const Deck & rhs) = default;
 
 	//Randomly shuffles deck
 	void Shuffle();
 
+	//Randomly shuffles deck with a specific generator
+	template <typename Generator>
+	void Shuffle(Generator & generator);
+
+	//Arranges deck in the order of a classic numbered deal
+	void DealGameNumber(unsigned int gameNumber);
+
 	//Deals card from deck
 	Card Deal();
 
 private:
+	//Puts cards back in sequential order
+	void ResetOrder();
+
 	Card m_deck[NUM_CARDS_DECK];	//Array of 52 Cards
 	int m_current_card;				//Counter for current card to be dealt from the deck
 };
 
+/**********************************************************************
+* Purpose:
+*	To reorder all 52 cards in the deck with a Fisher-Yates shuffle
+*	driven by the given generator. The deck is put back in sequential
+*	order first, so a generator in the same state always produces the
+*	same deal. Also resets the current card back to the top of the
+*	deck.
+*
+* Precondition:
+*	A generator with an unsigned long long Next() method.
+*
+* Postcondition:
+*	The cards in the deck are randomly shuffled and the current card
+*	is reset to the first card in the deck.
+**********************************************************************/
+template <typename Generator>
+void Deck::Shuffle(Generator & generator)
+{
+	ResetOrder();
+
+	//Swap each card with a random card at or below it
+	for (int i = NUM_CARDS_DECK - 1; i > 0; i--)
+	{
+		//Scale the high 32 bits into [0, i] (multiply-shift instead of modulo)
+		int j = static_cast<int>(((generator.Next() >> 32) * (i + 1)) >> 32);
+
+		Card temp = m_deck[i];
+		m_deck[i] = m_deck[j];
+		m_deck[j] = temp;
+	}
+
+	//Reset current card to first card in deck
+	m_current_card = 0;
+}
+
 #endif //DECK_H
\ No newline at end of file
@@ -25,65 +25,6 @@ using std::cin;
 Freecell::Freecell() : m_endGame(false)
 {}
 
-/**********************************************************************
-* Purpose:
-*	To construct an instance of an Freecell game with data members
-*	whose initial values are copied from data members of an existing
-*	Freecell object.
-*
-* Precondition:
-*	An existing Freecell object passed by const ref.
-*
-* Postcondition:
-*	The data members are initialized to the values of the data members
-*	of the existing Freecell object.
-**********************************************************************/
-Freecell::Freecell(const Freecell & copy) : m_endGame(false)
-{
-	*this = copy;	//Use assignment operator
-}
-
-/**********************************************************************
-* Purpose:
-*	To destroy the Freecell game object and reset the data members to
-*	default values.
-*
-* Precondition:
-*	<None>
-*
-* Postcondition:
-*	Data members are reset to default values.
-**********************************************************************/
-Freecell::~Freecell()
-{
-	//Reset to default value
-	m_endGame = false;
-}
-
-/**********************************************************************
-* Purpose:
-*	To assign one existing Freecell object to another existing Freecell
-*	object by copying values of data members from one to another.
-*
-* Precondition:
-*	An existing Freecell object passed by const ref.
-*
-* Postcondition:
-*	One existing Freecell object is assigned to another existing
-*	Freecell object.
-**********************************************************************/
-Freecell & Freecell::operator=(const Freecell & rhs)
-{
-	//Check for self-assignment
-	if (this != &rhs)
-	{
-		m_gameBoard = rhs.m_gameBoard;	//Use Board's assignment operator
-		m_endGame = rhs.m_endGame;
-	}
-
-	return *this;
-}
-
 /**********************************************************************
 * Purpose:
 *	To provide the entry into the game and exit out of the game.
@@ -131,17 +72,27 @@ void Freecell::RunGame()
 **********************************************************************/
 void Freecell::GameLoop()
 {
-	//Display initial game board
+	//Send the cards that are already safe home, and display initial game board
+	m_gameBoard.AutoPlay();
 	m_gameBoard.DisplayBoard();
 
 	//Stay in loop until user wins or quits
 	while (m_endGame != true)
 	{
 		ChooseAction();
+
+		//Check if user won game
+		if (m_gameBoard.WonGame() == true)
+		{
+			m_endGame = true;
+			cout << "\n\nYou won!\n\n";
+		}
 	}
 
 	//Reset state of game to be able to start over
 	m_gameBoard.ResetNewBoard();
+	m_journal.Clear();
+	m_hints.Clear();
 	m_endGame = false;
 }
 
@@ -168,15 +119,18 @@ void Freecell::ChooseAction()
 		<< "3) Move from play area to home cell area\n"
 		<< "4) Move from free cell area to play area\n"
 		<< "5) Move from free cell area to home area\n"
-		<< "6) Quit this game\n";
+		<< "6) Undo last move\n"
+		<< "7) Redo undone move\n"
+		<< "8) Show a hint\n"
+		<< "9) Quit this game\n";
 	cout << "Your choice: ";
 	cin >> choice;
 	cin.clear();
 	cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
 
-	while (choice < 1 || choice > 6)
+	while (choice < 1 || choice > 9)
 	{
-		cout << "\nChoice must be a number between 1 and 6. Please try again: ";
+		cout << "\nChoice must be a number between 1 and 9. Please try again: ";
 		cin >> choice;
 		cin.clear();
 		cin.ignore(cin.rdbuf()->in_avail());	//In case char goes into an int
@@ -218,6 +172,15 @@ void Freecell::InterpretActionChoice(int choice)
 		MoveFreeToHome();
 		break;
 	case 6:
+		UndoMove();
+		break;
+	case 7:
+		RedoMove();
+		break;
+	case 8:
+		ShowHint();
+		break;
+	case 9:
 		m_endGame = true;
 		break;
 	}
@@ -289,8 +252,10 @@ void Freecell::MovePlayToPlay()
 	{
 		try
 		{
-			//Move cards from one column to another in play area, and re-display board
+			//Move cards from one column to another in play area, send safe cards home, and re-display board
 			m_gameBoard.MovePlayToPlay(column1, column2, numCards);
+			m_journal.Record(Move(PLAY_TO_PLAY, column1, column2, numCards));
+			m_journal.AutoPlay(m_gameBoard);
 			m_gameBoard.DisplayBoard();
 		}
 		catch (Exception & ex)
@@ -353,8 +318,10 @@ void Freecell::MovePlayToFree()
 
 	try
 	{
-		//Move cards from a column to a free cell, and re-display board
+		//Move cards from a column to a free cell, send safe cards home, and re-display board
 		m_gameBoard.MovePlayToFree(column, index);
+		m_journal.Record(Move(PLAY_TO_FREE, column, index));
+		m_journal.AutoPlay(m_gameBoard);
 		m_gameBoard.DisplayBoard();
 	}
 	catch (Exception & ex)
@@ -416,8 +383,10 @@ void Freecell::MovePlayToHome()
 
 	try
 	{
-		//Move cards from a column to a free cell, and re-display board
+		//Move cards from a column to a free cell, send safe cards home, and re-display board
 		m_gameBoard.MovePlayToHome(column, index);
+		m_journal.Record(Move(PLAY_TO_HOME, column, index));
+		m_journal.AutoPlay(m_gameBoard);
 		m_gameBoard.DisplayBoard();
 	}
 	catch (Exception & ex)
@@ -426,13 +395,6 @@ void Freecell::MovePlayToHome()
 		m_gameBoard.DisplayBoard();
 		cout << "\n" << ex;
 	}
-
-	//Check if user won game
-	if (m_gameBoard.WonGame() == true)
-	{
-		m_endGame = true;
-		cout << "\n\nYou won!\n\n";
-	}
 }
 
 /**********************************************************************
@@ -485,8 +447,10 @@ void Freecell::MoveFreeToPlay()
 
 	try
 	{
-		//Move cards from a free cell to a play area column, and re-display board
+		//Move cards from a free cell to a play area column, send safe cards home, and re-display board
 		m_gameBoard.MoveFreeToPlay(index, column);
+		m_journal.Record(Move(FREE_TO_PLAY, index, column));
+		m_journal.AutoPlay(m_gameBoard);
 		m_gameBoard.DisplayBoard();
 	}
 	catch (Exception & ex)
@@ -547,8 +511,10 @@ void Freecell::MoveFreeToHome()
 
 	try
 	{
-		//Move cards from a free cell to a home cell, and re-display board
+		//Move cards from a free cell to a home cell, send safe cards home, and re-display board
 		m_gameBoard.MoveFreeToHome(freeCellIndex, homeCellIndex);
+		m_journal.Record(Move(FREE_TO_HOME, freeCellIndex, homeCellIndex));
+		m_journal.AutoPlay(m_gameBoard);
 		m_gameBoard.DisplayBoard();
 	}
 	catch (Exception & ex)
@@ -557,11 +523,123 @@ void Freecell::MoveFreeToHome()
 		m_gameBoard.DisplayBoard();
 		cout << "\n" << ex;
 	}
+}
 
-	//Check if user won game
-	if (m_gameBoard.WonGame() == true)
+/**********************************************************************
+* Purpose:
+*	To take back the last move the user made, along with the cards
+*	sent home automatically after it.
+*
+* Precondition:
+*	User chose to undo a move.
+*
+* Postcondition:
+*	The last move not yet undone is reversed, if there is one.
+**********************************************************************/
+void Freecell::UndoMove()
+{
+	try
 	{
-		m_endGame = true;
-		cout << "\n\nYou won!\n\n";
+		//Reverse the last move and its automatic moves, and re-display board
+		m_journal.UndoTurn(m_gameBoard);
+		m_gameBoard.DisplayBoard();
 	}
-}
\ No newline at end of file
+	catch (Exception & ex)
+	{
+		//Re-display board and display exception
+		m_gameBoard.DisplayBoard();
+		cout << "\n" << ex;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To make the last undone move again, along with the cards sent home
+*	automatically after it.
+*
+* Precondition:
+*	User chose to redo a move.
+*
+* Postcondition:
+*	The last undone move is made again, if there is one and no other
+*	move has been made since it was undone.
+**********************************************************************/
+void Freecell::RedoMove()
+{
+	try
+	{
+		//Make the undone move and its automatic moves again, and re-display board
+		m_journal.RedoTurn(m_gameBoard);
+		m_gameBoard.DisplayBoard();
+	}
+	catch (Exception & ex)
+	{
+		//Re-display board and display exception
+		m_gameBoard.DisplayBoard();
+		cout << "\n" << ex;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To suggest a move to the user, with what the search behind it
+*	found out about the game.
+*
+* Precondition:
+*	User chose to see a hint.
+*
+* Postcondition:
+*	The board is re-displayed with the suggested move, or a message
+*	that there is none.
+**********************************************************************/
+void Freecell::ShowHint()
+{
+	Move move;										//Move to suggest
+	bool found = m_hints.GetHint(m_gameBoard, move);	//Flags that there is a move to suggest
+
+	m_gameBoard.DisplayBoard();
+
+	if (!found)
+	{
+		cout << "\nNo hint: there are no legal moves.";
+		return;
+	}
+
+	cout << "\nHint: ";
+
+	switch (move.GetType())
+	{
+	case PLAY_TO_PLAY:
+		cout << "Move " << move.GetCount() << " card(s) from play area column " << move.GetFrom()
+			<< " to play area column " << move.GetTo() << ".";
+		break;
+	case PLAY_TO_FREE:
+		cout << "Move the card from play area column " << move.GetFrom() << " to free cell " << move.GetTo() << ".";
+		break;
+	case PLAY_TO_HOME:
+		cout << "Move the card from play area column " << move.GetFrom() << " to home cell " << move.GetTo() << ".";
+		break;
+	case FREE_TO_PLAY:
+		cout << "Move the card from free cell " << move.GetFrom() << " to play area column " << move.GetTo() << ".";
+		break;
+	case FREE_TO_HOME:
+		cout << "Move the card from free cell " << move.GetFrom() << " to home cell " << move.GetTo() << ".";
+		break;
+	}
+
+	switch (m_hints.GetStatus())
+	{
+	case SOLVE_SOLVED:
+		cout << "\nThis move leads to a win.";
+		break;
+	case SOLVE_UNSOLVABLE:
+		cout << "\nThe game can no longer be won, but this move gets the most cards home.";
+		break;
+	case SOLVE_TIME_LIMIT:
+		cout << "\nThis is the best move found so far. Ask again to search further.";
+		break;
+	default:
+		cout << "\nThis is the best move found.";
+		break;
+	}
+}
@@ -16,6 +16,9 @@
 *		the bool to signal the end of the game, initialized to false.
 *
 *	Freecell(const Freecell & copy)
+*		Copies the game. The board is stored inline and copied flat;
+*		the move journal is copied with it so the copy can undo the
+*		same moves.
 *
 *	~Freecell()
 *
@@ -53,11 +56,22 @@
 *	void MoveFreeToHome()
 *		Allows user to specify which card to move from free cell area
 *		to home cell area.
+*
+*	void UndoMove()
+*		Takes back the last move made.
+*
+*	void RedoMove()
+*		Makes the last undone move again.
+*
+*	void ShowHint()
+*		Suggests a move, found within HINT_DEFAULT_TIME_LIMIT.
 **********************************************************************/
 #ifndef FREECELL_H
 #define FREECELL_H
 
 #include "board.h"
+#include "moveJournal.h"
+#include "hintEngine.h"
 
 class Freecell
 {
@@ -66,13 +80,13 @@ class Freecell
 		Freecell();
 		
 		//Copy Ctor
-		Freecell(const Freecell & copy);
+		Freecell(const Freecell & copy) = default;
 
 		//Default Dtor
-		~Freecell();
+		~Freecell() = default;
 
 		//Assignment Operator
-		Freecell & operator=(const Freecell & rhs);
+		Freecell & operator=(const Freecell & rhs) = default;
 
 		//Provides entrance into game and exit out of game.
 		void RunGame();
@@ -102,8 +116,19 @@ class Freecell
 		//Allows user to specify which card to move from free cell area to home cell area
 		void MoveFreeToHome();
 
-		Board m_gameBoard;	//Freecell game board
-		bool m_endGame;		//Flag that the game has ended
+		//Takes back the last move made
+		void UndoMove();
+
+		//Makes the last undone move again
+		void RedoMove();
+
+		//Suggests a move
+		void ShowHint();
+
+		Board m_gameBoard;		//Freecell game board
+		MoveJournal m_journal;	//Moves made, for undo and redo
+		HintEngine m_hints;		//Finds moves to suggest, keeping its work between hints
+		bool m_endGame;			//Flag that the game has ended
 };
 
 #endif //FREECELL_H
\ No newline at end of file
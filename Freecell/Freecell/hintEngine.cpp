@@ -0,0 +1,269 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			hintEngine.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "hintEngine.h"
+
+#include <chrono>
+#include <climits>
+
+/**********************************************************************
+* Purpose:
+*	To construct a HintEngine with the default time limit.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values, with no line kept.
+**********************************************************************/
+HintEngine::HintEngine() : m_solver(SOLVER_DEFAULT_NODE_LIMIT, HINT_MEMORY_LIMIT), m_searchHash(0), m_searched(false),
+	m_status(SOLVE_UNSOLVABLE)
+{
+	m_solver.SetTimeLimit(HINT_DEFAULT_TIME_LIMIT);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a HintEngine with a given time limit.
+*
+* Precondition:
+*	The most milliseconds a hint may search.
+*
+* Postcondition:
+*	Data members are initialized, with no line kept.
+**********************************************************************/
+HintEngine::HintEngine(int timeLimit) : m_solver(SOLVER_DEFAULT_NODE_LIMIT, HINT_MEMORY_LIMIT), m_searchHash(0),
+	m_searched(false), m_status(SOLVE_UNSOLVABLE)
+{
+	m_solver.SetTimeLimit(timeLimit);
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the move to suggest for a board. A winning line kept from
+*	an earlier hint answers at once if it passes through the board. A
+*	hint for the board the last search began from continues that
+*	search if the time limit stopped it, or answers from its line if
+*	it ended for good. Any other board that the last search stored is
+*	made its new start, so the search goes on below it (for the time
+*	limit less the time taken to move it); a board it did not store is
+*	searched from nothing. If the search found no position better than
+*	the board itself, so its line is empty, the legal move that scores
+*	best is suggested instead.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	True is returned and the move is set, if the board has a legal
+*	move; else, false is returned. GetStatus() tells how the search
+*	behind the hint ended.
+**********************************************************************/
+bool HintEngine::GetHint(const Board & board, Move & move)
+{
+	bool sameStart = m_searched && board.GetHash() == m_searchHash;	//Flags the board the last search began from
+
+	if (m_status == SOLVE_SOLVED && FindInLine(board, move))
+		return true;
+
+	if (!sameStart)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();	//When the hint began
+
+		m_searchHash = board.GetHash();
+		m_searched = true;
+
+		if (m_solver.Reroot(board))
+		{
+			int timeLimit = m_solver.GetTimeLimit();	//Time limit of a whole hint
+			int elapsed = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::steady_clock::now() - start).count());	//Milliseconds taken to reroot
+
+			if (timeLimit > 0)
+				m_solver.SetTimeLimit((elapsed < timeLimit) ? timeLimit - elapsed : 1);
+
+			m_status = m_solver.Continue();
+			m_solver.SetTimeLimit(timeLimit);
+		}
+		else
+			m_status = m_solver.Solve(board);
+	}
+	else if (m_status == SOLVE_TIME_LIMIT)
+		m_status = m_solver.Continue();
+	else
+		return FindInLine(board, move) || FindBestMove(board, move);	//Searching again would find the same line
+
+	KeepLine(board, m_solver.GetBestLine());
+
+	return FindInLine(board, move) || FindBestMove(board, move);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return how the search behind the last hint ended.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The status of the last search is returned.
+**********************************************************************/
+SolveStatus HintEngine::GetStatus() const
+{
+	return m_status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most milliseconds a hint may search.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The time limit is returned.
+**********************************************************************/
+int HintEngine::GetTimeLimit() const
+{
+	return m_solver.GetTimeLimit();
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the most milliseconds a hint may search.
+*
+* Precondition:
+*	A number of milliseconds.
+*
+* Postcondition:
+*	The time limit is set to the parameter value.
+**********************************************************************/
+void HintEngine::SetTimeLimit(int timeLimit)
+{
+	m_solver.SetTimeLimit(timeLimit);
+}
+
+/**********************************************************************
+* Purpose:
+*	To forget the lines and search kept from earlier hints, such as
+*	when a new game starts.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	No line is kept, and the next hint searches from the start.
+**********************************************************************/
+void HintEngine::Clear()
+{
+	m_line.resize(0);
+	m_lineHashes.resize(0);
+	m_searchHash = 0;
+	m_searched = false;
+	m_status = SOLVE_UNSOLVABLE;
+}
+
+/**********************************************************************
+* Purpose:
+*	To keep a line of moves, making them again from its start to find
+*	the hash of the board before each one.
+*
+* Precondition:
+*	The board the line starts from, passed by const ref, and the moves
+*	of the line.
+*
+* Postcondition:
+*	The line and its hashes are kept, replacing any kept before.
+**********************************************************************/
+void HintEngine::KeepLine(const Board & start, const Array<Move> & line)
+{
+	Board board = start;	//Board the moves are made on again
+
+	m_line = line;
+	m_lineHashes.resize(0);
+
+	for (int i = 0; i < line.getLength(); i++)
+	{
+		m_lineHashes.push_back(board.GetHash());
+		board.MakeMove(line[i]);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the move the kept line makes from a board. The move is
+*	checked against the board, so a board that only shares a hash with
+*	one on the line is never given a move it cannot make.
+*
+* Precondition:
+*	An existing Board object passed by const ref and a Move passed by
+*	ref to receive the move.
+*
+* Postcondition:
+*	True is returned and the move is set, if the line passes through
+*	the board; else, false is returned.
+**********************************************************************/
+bool HintEngine::FindInLine(const Board & board, Move & move) const
+{
+	unsigned long long hash = board.GetHash();	//Hash of the board
+
+	for (int i = 0; i < m_line.getLength(); i++)
+	{
+		if (m_lineHashes[i] == hash && board.CanMove(m_line[i]) == MOVE_OK)
+		{
+			move = m_line[i];
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the legal move whose board scores best by
+*	Solver::Evaluate(), after sending home the cards the move frees.
+*	Used when the search's line does not pass through the board.
+*
+* Precondition:
+*	An existing Board object passed by const ref and a Move passed by
+*	ref to receive the move.
+*
+* Postcondition:
+*	True is returned and the move is set, if the board has a legal
+*	move; else, false is returned.
+**********************************************************************/
+bool HintEngine::FindBestMove(const Board & board, Move & move) const
+{
+	Board current = board;				//Board the moves are tried on
+	Move moves[MAX_LEGAL_MOVES];		//Legal moves from the board
+	Move autoMoves[NUM_CARDS_DECK];		//Cards sent home after a move
+	int numMoves = current.GenerateMoves(moves, MAX_LEGAL_MOVES, MOVE_FILTER_ALL | MOVE_FILTER_DISTINCT);
+	int bestScore = INT_MAX;			//Estimate of the best move's board
+
+	for (int i = 0; i < numMoves; i++)
+	{
+		current.MakeMove(moves[i]);
+
+		int numAutoMoves = current.AutoPlay(autoMoves, NUM_CARDS_DECK);	//Cards sent home after the move
+		int score = current.WonGame() ? INT_MIN : Solver::Evaluate(current);	//Estimate of the move's board
+
+		if (score < bestScore)
+		{
+			bestScore = score;
+			move = moves[i];
+		}
+
+		//Take the move back for the next one
+		while (numAutoMoves > 0)
+			current.UndoMove(autoMoves[--numAutoMoves]);
+
+		current.UndoMove(moves[i]);
+	}
+
+	return numMoves > 0;
+}
@@ -0,0 +1,126 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			hintEngine.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: HintEngine
+*
+* Purpose:
+*	This class suggests a move for the player within a time limit. It
+*	runs the Solver with that time limit and suggests the first move of
+*	the best line the search found: the way to a win if it found one,
+*	else the way to the most promising position it reached.
+*
+*	The work of one hint is kept for the next. A winning line is kept
+*	with the hash of the board before each of its moves, so as long as
+*	the player follows it (or takes moves back along it), every later
+*	hint is found at once without searching. A search stopped by the
+*	time limit is continued, not started again, when the player asks
+*	again without moving, so each hint for the same board searches
+*	further than the last. When the player makes a move off the line,
+*	the search is rerooted on the new board if it stored it (see
+*	Solver::Reroot()), as it has most boards a move or two from where
+*	it began, so the positions found below the new board are kept and
+*	the search goes on from them. If the search finds no position
+*	better than the board itself, the legal move whose board scores
+*	best is suggested, so there is a hint whenever there is a move.
+*
+*	Reuse stops at what the search stored. A board it never reached
+*	is searched from nothing, and the positions of the old search that
+*	are not below the new board are dropped, since the best-first
+*	search only keeps which positions it has stored, and a kept entry
+*	for a position it can no longer reach would hide that position
+*	from the new search.
+*
+* Manager functions:
+*	HintEngine()
+*		Creates a HintEngine with HINT_DEFAULT_TIME_LIMIT.
+*
+*	HintEngine(int timeLimit)
+*		Creates a HintEngine whose hints take no more than the given
+*		number of milliseconds of searching.
+*
+*	HintEngine(const HintEngine & copy)
+*
+*	~HintEngine()
+*
+*	HintEngine & operator=(const HintEngine & rhs)
+*
+* Methods:
+*	bool GetHint(const Board & board, Move & move)
+*		Finds the move to suggest for a board. Returns false only if
+*		the board has no legal move.
+*
+*	SolveStatus GetStatus() const
+*		Returns how the search behind the last hint ended: SOLVE_SOLVED
+*		if the hint leads to a win, SOLVE_UNSOLVABLE if the game can no
+*		longer be won, or the limit that stopped the search.
+*
+*	int GetTimeLimit() const
+*	void SetTimeLimit(int timeLimit)
+*		Get and set the most milliseconds a hint may search.
+*
+*	void Clear()
+*		Forgets the lines and search kept from earlier hints.
+**********************************************************************/
+#ifndef HINT_ENGINE_H
+#define HINT_ENGINE_H
+
+#include "solver.h"
+
+const int HINT_DEFAULT_TIME_LIMIT = 50;									//Milliseconds a hint may search
+const size_t HINT_MEMORY_LIMIT = static_cast<size_t>(64) << 20;		//Bytes the hint search may use
+
+class HintEngine
+{
+public:
+	//Default Ctor
+	HintEngine();
+
+	//1-Arg Overloaded Ctor
+	explicit HintEngine(int timeLimit);
+
+	//Copy Ctor
+	HintEngine(const HintEngine & copy) = default;
+
+	//Default Dtor
+	~HintEngine() = default;
+
+	//Assignment Operator
+	HintEngine & operator=(const HintEngine & rhs) = default;
+
+	//Finds the move to suggest for a board
+	bool GetHint(const Board & board, Move & move);
+
+	//Getter for m_status
+	SolveStatus GetStatus() const;
+
+	//Returns the most milliseconds a hint may search
+	int GetTimeLimit() const;
+
+	//Sets the most milliseconds a hint may search
+	void SetTimeLimit(int timeLimit);
+
+	//Forgets the lines and search kept from earlier hints
+	void Clear();
+
+private:
+	//Keeps a line of moves and the hash of the board before each one
+	void KeepLine(const Board & start, const Array<Move> & line);
+
+	//Finds the move the kept line makes from a board, if it passes through it
+	bool FindInLine(const Board & board, Move & move) const;
+
+	//Finds the legal move whose board scores best
+	bool FindBestMove(const Board & board, Move & move) const;
+
+	Solver m_solver;						//Search behind the hints
+	Array<Move> m_line;						//Best line of the last search
+	Array<unsigned long long> m_lineHashes;	//Hash of the board before each move of the line
+	unsigned long long m_searchHash;		//Hash of the board the last search began from
+	bool m_searched;						//Flags that a search has been run
+	SolveStatus m_status;					//How the last search ended
+};
+
+#endif //HINT_ENGINE_H
@@ -7,7 +7,13 @@
 * Class: LinkedList
 *
 * Purpose:
-*	This class simulates the actual list of a doubly linked list.
+*	This class simulates the actual list of a doubly linked list. The
+*	Allocator policy decides where nodes come from: HeapNodeAllocator
+*	(the default) uses new and delete for each node, and
+*	PooledNodeAllocator uses the calling thread's NodePool (see
+*	nodePool.h). Each pooled node goes back to the pool it came from,
+*	so a pooled list may be handed to another thread and emptied or
+*	destroyed there.
 *
 * Manager functions:
 *	LinkedList()
@@ -16,11 +22,22 @@
 *
 *	LinkedList(const LinkedList & copy)
 *
+*	LinkedList(LinkedList && other)
+*		Takes over the nodes of other without copying, and leaves other
+*		empty.
+*
 *	~LinkedList()
 *
 *	LinkedList<T> & operator=(const LinkedList<T> & rhs)
 *
+*	LinkedList<T> & operator=(LinkedList<T> && rhs)
+*		Removes this list's nodes and takes over the nodes of rhs
+*		without copying, leaving rhs empty.
+*
 * Methods:
+*	void Swap(LinkedList<T> & other)
+*		Exchanges the nodes of two lists without copying items.
+*
 *	bool isEmpty() const
 *		Checks if list is empty.
 *
@@ -48,6 +65,28 @@
 *	void Extract(const T & data)
 *		Removes a single item/Node from the list
 *
+*	T PopFront()
+*		Removes the first item/Node from the list and returns its data.
+*
+*	T PopBack()
+*		Removes the last item/Node from the list and returns its data.
+*
+*	Iterator Begin()
+*		Returns an iterator to the first item/Node in the list.
+*
+*	Iterator End()
+*		Returns an iterator one past the last item/Node in the list.
+*
+*	Iterator Erase(Iterator position)
+*		Removes the item/Node the iterator refers to and returns an
+*		iterator to the item/Node after it.
+*
+*	void Splice(Iterator position, LinkedList<T> & other,
+*				Iterator first, Iterator last)
+*		Moves the items/Nodes from first up to (not including) last out
+*		of other and links them in before position, without copying or
+*		allocating.
+*
 *	void PrintForwards()
 *		Displays the data of each item/Node in the list from front to
 *		end.
@@ -55,27 +94,82 @@
 *	void PrintBackwards()
 *		Displays the data of each item/Node in the list from end to
 *		front.
+*
+* Class: LinkedList<T>::Iterator
+*
+* Purpose:
+*	This class is a bidirectional iterator over the items/Nodes of a
+*	LinkedList. Decrementing the End() iterator moves to the last
+*	item/Node.
 **********************************************************************/
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
 #include "node.h"
+#include "nodePool.h"
+
+#include <new>
 
-template <typename T>
+template <typename T, typename Allocator = HeapNodeAllocator>
 class LinkedList
 {
 public:
+	//Bidirectional iterator over the items/Nodes of the list
+	class Iterator
+	{
+	public:
+		//Default Ctor
+		Iterator();
+
+		//Returns a reference to the data the iterator refers to
+		T & operator*() const;
+
+		//Returns a pointer to the data the iterator refers to
+		T * operator->() const;
+
+		//Moves to next item/Node (prefix and postfix)
+		Iterator & operator++();
+		Iterator operator++(int);
+
+		//Moves to previous item/Node (prefix and postfix)
+		Iterator & operator--();
+		Iterator operator--(int);
+
+		//Checks if two iterators refer to the same item/Node
+		bool operator==(const Iterator & rhs) const;
+		bool operator!=(const Iterator & rhs) const;
+
+	private:
+		//LinkedList creates iterators and reads their Nodes
+		friend class LinkedList<T, Allocator>;
+
+		//2-Arg Overloaded Ctor
+		Iterator(Node<T> * node, const LinkedList<T, Allocator> * list);
+
+		Node<T> * m_node;				//Node the iterator refers to, nullptr at end of list
+		const LinkedList<T, Allocator> * m_list;	//List the iterator belongs to (to step back from the end)
+	};
+
 	//Default Ctor
 	LinkedList();
 
 	//Copy Ctor
-	LinkedList(const LinkedList & copy);
+	LinkedList(const LinkedList<T, Allocator> & copy);
+
+	//Move Ctor
+	LinkedList(LinkedList<T, Allocator> && other) noexcept;
 
 	//Default Dtor
 	~LinkedList();
 
 	//Assignment Operator
-	LinkedList<T> & operator=(const LinkedList<T> & rhs);
+	LinkedList<T, Allocator> & operator=(const LinkedList<T, Allocator> & rhs);
+
+	//Move Assignment Operator
+	LinkedList<T, Allocator> & operator=(LinkedList<T, Allocator> && rhs) noexcept;
+
+	//Exchanges the nodes of two lists
+	void Swap(LinkedList<T, Allocator> & other) noexcept;
 
 	//Checks if list is empty
 	bool isEmpty() const;
@@ -104,6 +198,24 @@ public:
 	//Removes a single item/Node from the list
 	void Extract(const T & data);
 
+	//Removes the first item/Node from the list and returns its data
+	T PopFront();
+
+	//Removes the last item/Node from the list and returns its data
+	T PopBack();
+
+	//Returns an iterator to the first item/Node in the list
+	Iterator Begin();
+
+	//Returns an iterator one past the last item/Node in the list
+	Iterator End();
+
+	//Removes the item/Node an iterator refers to
+	Iterator Erase(Iterator position);
+
+	//Moves a range of items/Nodes from another list in front of position
+	void Splice(Iterator position, LinkedList<T, Allocator> & other, Iterator first, Iterator last);
+
 	//Displays the data of each item/Node in the list from front to end
 	void PrintForwards();
 
@@ -111,6 +223,12 @@ public:
 	void PrintBackwards();
 
 private:
+	//Allocates and constructs a node holding data
+	Node<T> * CreateNode(const T & data);
+
+	//Destroys a node and returns its memory to the allocator
+	void DestroyNode(Node<T> * node);
+
 	Node<T> * m_head;	//head pointer, points to first node in list
 	Node<T> * m_tail;	//tail pointer, points to last node in list
 };
@@ -126,8 +244,8 @@ members to default values.
 * Postcondition:
 *	Data members are initialized to default values.
 **********************************************************************/
-template<typename T>
-LinkedList<T>::LinkedList() : m_head(nullptr), m_tail(nullptr)
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList() : m_head(nullptr), m_tail(nullptr)
 {}
 
 /**********************************************************************
@@ -143,11 +261,39 @@ LinkedList<T>::LinkedList() : m_head(nullptr), m_tail(nullptr)
 *	The data members are initialized to the values of the data members
 *	of the existing LinkedList object.
 **********************************************************************/
-template<typename T>
-LinkedList<T>::LinkedList(const LinkedList & copy) : m_head(nullptr), m_tail(nullptr)
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(const LinkedList<T, Allocator> & copy) : m_head(nullptr), m_tail(nullptr)
+{
+	//Traveling pointer to traverse parameter list
+	Node<T> * copyTravel = copy.m_head;
+
+	//Add each node from parameter list to this (empty) list
+	while (copyTravel != nullptr)
+	{
+		Append(copyTravel->m_data);
+		copyTravel = copyTravel->m_next;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a LinkedList that takes over the nodes
+*	of an existing LinkedList object instead of copying them. Iterators
+*	into the other list must not be used afterwards.
+*
+* Precondition:
+*	An existing LinkedList object that is about to be discarded.
+*
+* Postcondition:
+*	This list holds the nodes of the other list, and the other list is
+*	empty.
+**********************************************************************/
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::LinkedList(LinkedList<T, Allocator> && other) noexcept : m_head(other.m_head), m_tail(other.m_tail)
 {
-	//Use assignment operator
-	*this = copy;
+	//Leave other empty so its Dtor does not delete the nodes
+	other.m_head = nullptr;
+	other.m_tail = nullptr;
 }
 
 /**********************************************************************
@@ -161,8 +307,8 @@ LinkedList<T>::LinkedList(const LinkedList & copy) : m_head(nullptr), m_tail(nul
 * Postcondition:
 *	Data members are re-initialized to default values.
 **********************************************************************/
-template<typename T>
-LinkedList<T>::~LinkedList()
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::~LinkedList()
 {
 	//Remove and delete all nodes
 	Purge();
@@ -185,8 +331,8 @@ LinkedList<T>::~LinkedList()
 *	One existing LinkedList object object is assigned to another
 *	existing LinkedList object.
 **********************************************************************/
-template<typename T>
-LinkedList<T> & LinkedList<T>::operator=(const LinkedList<T> & rhs)
+template<typename T, typename Allocator>
+LinkedList<T, Allocator> & LinkedList<T, Allocator>::operator=(const LinkedList<T, Allocator> & rhs)
 {
 	//Traveling pointer to traverse parameter list
 	Node<T> * rhsTravel = rhs.m_head;
@@ -210,6 +356,62 @@ LinkedList<T> & LinkedList<T>::operator=(const LinkedList<T> & rhs)
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To remove all nodes from this list and take over the nodes of an
+*	existing LinkedList object instead of copying them. Iterators into
+*	the other list must not be used afterwards.
+*
+* Precondition:
+*	An existing LinkedList object that is about to be discarded.
+*
+* Postcondition:
+*	This list holds the nodes of the other list, and the other list is
+*	empty.
+**********************************************************************/
+template<typename T, typename Allocator>
+LinkedList<T, Allocator> & LinkedList<T, Allocator>::operator=(LinkedList<T, Allocator> && rhs) noexcept
+{
+	//If addresses of objects are not the same
+	if (this != &rhs)
+	{
+		//Clear this list
+		Purge();
+
+		m_head = rhs.m_head;
+		m_tail = rhs.m_tail;
+
+		//Leave rhs empty so its Dtor does not delete the nodes
+		rhs.m_head = nullptr;
+		rhs.m_tail = nullptr;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the nodes of two lists by swapping their head and tail
+*	pointers. No items are copied and no nodes are allocated.
+*
+* Precondition:
+*	An existing LinkedList object passed by ref.
+*
+* Postcondition:
+*	Each list holds the nodes the other one held.
+**********************************************************************/
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Swap(LinkedList<T, Allocator> & other) noexcept
+{
+	Node<T> * tempHead = m_head;
+	m_head = other.m_head;
+	other.m_head = tempHead;
+
+	Node<T> * tempTail = m_tail;
+	m_tail = other.m_tail;
+	other.m_tail = tempTail;
+}
+
 /**********************************************************************
 * Purpose:
 *	To check if the list is empty.
@@ -220,8 +422,8 @@ LinkedList<T> & LinkedList<T>::operator=(const LinkedList<T> & rhs)
 * Postcondition:
 *	A bool signaling if the list is empty is returned.
 **********************************************************************/
-template<typename T>
-bool LinkedList<T>::isEmpty() const
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::isEmpty() const
 {
 	//Indicates list is empty if false
 	bool emptyList = false;
@@ -245,8 +447,8 @@ bool LinkedList<T>::isEmpty() const
 *	A constant reference to the data in the first node of the linked
 *	list is returned.
 **********************************************************************/
-template<typename T>
-const T & LinkedList<T>::First() const
+template<typename T, typename Allocator>
+const T & LinkedList<T, Allocator>::First() const
 {
 	//If list is empty, can't access first node
 	if (isEmpty())
@@ -269,8 +471,8 @@ const T & LinkedList<T>::First() const
 *	A constant reference to the data in the last node of the linked
 *	list is returned.
 **********************************************************************/
-template<typename T>
-const T & LinkedList<T>::Last() const
+template<typename T, typename Allocator>
+const T & LinkedList<T, Allocator>::Last() const
 {
 	//If list is empty, can't access last node
 	if (isEmpty())
@@ -291,11 +493,11 @@ const T & LinkedList<T>::Last() const
 * Postcondition:
 *	An item is added to the front of the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::Prepend(const T & data)
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Prepend(const T & data)
 {
 	//Create new node to add to list
-	Node<T> * newNode = new Node<T>(data);
+	Node<T> * newNode = CreateNode(data);
 
 	//If list is empty
 	if (isEmpty())
@@ -323,11 +525,11 @@ void LinkedList<T>::Prepend(const T & data)
 * Postcondition:
 *	An item is added to the end of the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::Append(const T & data)
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Append(const T & data)
 {
 	//Create new node to add to list
-	Node<T> * newNode = new Node<T>(data);
+	Node<T> * newNode = CreateNode(data);
 
 	//If list is empty
 	if (isEmpty())
@@ -356,8 +558,8 @@ void LinkedList<T>::Append(const T & data)
 * Postcondition:
 *	An item is inserted before an existing item in the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::InsertBefore(const T & newData, const T & existingData)
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::InsertBefore(const T & newData, const T & existingData)
 {
 	//If list is empty
 	if (isEmpty())
@@ -392,7 +594,7 @@ void LinkedList<T>::InsertBefore(const T & newData, const T & existingData)
 		else
 		{
 			//Create new node to add to list
-			Node<T> * newNode = new Node<T>(newData);
+			Node<T> * newNode = CreateNode(newData);
 
 			//Insert new node before node travel's next pointer points to
 			newNode->m_next = travel->m_next;
@@ -414,8 +616,8 @@ void LinkedList<T>::InsertBefore(const T & newData, const T & existingData)
 * Postcondition:
 *	An item is inserted after an existing item in the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::InsertAfter(const T & newData, const T & existingData)
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::InsertAfter(const T & newData, const T & existingData)
 {
 	//If list is empty
 	if (isEmpty())
@@ -453,7 +655,7 @@ void LinkedList<T>::InsertAfter(const T & newData, const T & existingData)
 			else
 			{
 				//Create new node to add to list
-				Node<T> * newNode = new Node<T>(newData);
+				Node<T> * newNode = CreateNode(newData);
 
 				//Insert new node after node travel points to
 				newNode->m_next = travel->m_next;
@@ -475,8 +677,8 @@ void LinkedList<T>::InsertAfter(const T & newData, const T & existingData)
 * Postcondition:
 *	All items are removed from the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::Purge()
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Purge()
 {
 	//If list is not empty, remove all nodes
 	if (!isEmpty())
@@ -490,7 +692,7 @@ void LinkedList<T>::Purge()
 			//Point head to next node in list
 			m_head = m_head->m_next;
 			//Delete node trailing head pointer
-			delete trail;
+			DestroyNode(trail);
 			//Point trail to new first node in list
 			trail = m_head;
 		}
@@ -510,8 +712,8 @@ void LinkedList<T>::Purge()
 * Postcondition:
 *	An item is removed from the list.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::Extract(const T & data)
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Extract(const T & data)
 {
 	//If list is empty
 	if (isEmpty())
@@ -546,7 +748,7 @@ void LinkedList<T>::Extract(const T & data)
 				m_head = nullptr;
 				m_tail = nullptr;
 				//Delete node w/target data
-				delete travel;
+				DestroyNode(travel);
 			}
 			//Else if node w/target data (travel) is first node in list
 			else if (travel->m_previous == nullptr)
@@ -556,7 +758,7 @@ void LinkedList<T>::Extract(const T & data)
 				//Make node prior to travel the first node in list
 				travel->m_next->m_previous = nullptr;
 				//Delete node w/target data
-				delete travel;
+				DestroyNode(travel);
 			}
 			//Else if node w/target data (travel) is last node in list
 			else if (travel->m_next == nullptr)
@@ -566,7 +768,7 @@ void LinkedList<T>::Extract(const T & data)
 				//Make node previous to travel the last node in list
 				travel->m_previous->m_next = nullptr;
 				//Delete node w/target data
-				delete travel;
+				DestroyNode(travel);
 			}
 			//Else node w/target data (travel) is in middle of list
 			else
@@ -575,12 +777,260 @@ void LinkedList<T>::Extract(const T & data)
 				travel->m_previous->m_next = travel->m_next;
 				travel->m_next->m_previous = travel->m_previous;
 				//Delete node w/target data
-				delete travel;
+				DestroyNode(travel);
 			}
 		}
 	}
 }
 
+/**********************************************************************
+* Purpose:
+*	To remove the first item from the list and return its data in
+*	constant time.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The first item is removed from the list and its data is returned,
+*	if the list is not empty.
+**********************************************************************/
+template<typename T, typename Allocator>
+T LinkedList<T, Allocator>::PopFront()
+{
+	//If list is empty, can't remove first node
+	if (isEmpty())
+		throw("ERROR: Cannot remove a node when list is empty.");
+
+	Node<T> * first = m_head;	//Node being removed
+	T data = first->m_data;		//Data of node being removed
+
+	//Point head to next node in list
+	m_head = first->m_next;
+
+	//If removed node was only node in list
+	if (m_head == nullptr)
+		m_tail = nullptr;
+	else
+		m_head->m_previous = nullptr;
+
+	DestroyNode(first);
+
+	return data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove the last item from the list and return its data in
+*	constant time.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The last item is removed from the list and its data is returned,
+*	if the list is not empty.
+**********************************************************************/
+template<typename T, typename Allocator>
+T LinkedList<T, Allocator>::PopBack()
+{
+	//If list is empty, can't remove last node
+	if (isEmpty())
+		throw("ERROR: Cannot remove a node when list is empty.");
+
+	Node<T> * last = m_tail;	//Node being removed
+	T data = last->m_data;		//Data of node being removed
+
+	//Point tail to previous node in list
+	m_tail = last->m_previous;
+
+	//If removed node was only node in list
+	if (m_tail == nullptr)
+		m_head = nullptr;
+	else
+		m_tail->m_next = nullptr;
+
+	DestroyNode(last);
+
+	return data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an iterator to the first item in the list.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	An iterator to the first item is returned (equal to End() if the
+*	list is empty).
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::Begin()
+{
+	return Iterator(m_head, this);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an iterator one past the last item in the list.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The end iterator is returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::End()
+{
+	return Iterator(nullptr, this);
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove the item an iterator refers to in constant time.
+*
+* Precondition:
+*	An iterator to an item in this list (not End()).
+*
+* Postcondition:
+*	The item is removed and an iterator to the item after it is
+*	returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::Erase(Iterator position)
+{
+	Node<T> * travel = position.m_node;	//Node being removed
+
+	//Can't remove end of list or a node from another list
+	if (travel == nullptr || position.m_list != this)
+		throw("ERROR: Cannot remove a node that does not exist.");
+
+	Node<T> * next = travel->m_next;	//Node after the one being removed
+
+	//Unlink from node before (or head of list)
+	if (travel->m_previous == nullptr)
+		m_head = next;
+	else
+		travel->m_previous->m_next = next;
+
+	//Unlink from node after (or tail of list)
+	if (next == nullptr)
+		m_tail = travel->m_previous;
+	else
+		next->m_previous = travel->m_previous;
+
+	DestroyNode(travel);
+
+	return Iterator(next, this);
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the items from first up to (not including) last out of
+*	another list and link them in before position, in constant time.
+*	No items are copied and no nodes are allocated or deleted.
+*
+* Precondition:
+*	An iterator into this list, another list, and a range of iterators
+*	into the other list (first must come before or equal last).
+*
+* Postcondition:
+*	The range is removed from the other list and inserted, in the same
+*	order, before position in this list.
+**********************************************************************/
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::Splice(Iterator position, LinkedList<T, Allocator> & other, Iterator first, Iterator last)
+{
+	//Nothing to move for an empty range
+	if (first == last)
+		return;
+
+	if (position.m_list != this || first.m_list != &other || last.m_list != &other)
+		throw("ERROR: Cannot splice with iterators from a different list.");
+
+	Node<T> * rangeFirst = first.m_node;	//First node being moved
+	Node<T> * rangeLast = (last.m_node == nullptr) ? other.m_tail : last.m_node->m_previous;	//Last node being moved
+
+	//***Unlink range from other list
+
+	if (rangeFirst->m_previous == nullptr)
+		other.m_head = last.m_node;
+	else
+		rangeFirst->m_previous->m_next = last.m_node;
+
+	if (last.m_node == nullptr)
+		other.m_tail = rangeFirst->m_previous;
+	else
+		last.m_node->m_previous = rangeFirst->m_previous;
+
+	//***Link range into this list before position
+
+	Node<T> * before = (position.m_node == nullptr) ? m_tail : position.m_node->m_previous;	//Node range goes after
+
+	rangeFirst->m_previous = before;
+	rangeLast->m_next = position.m_node;
+
+	if (before == nullptr)
+		m_head = rangeFirst;
+	else
+		before->m_next = rangeFirst;
+
+	if (position.m_node == nullptr)
+		m_tail = rangeLast;
+	else
+		position.m_node->m_previous = rangeLast;
+}
+
+/**********************************************************************
+* Purpose:
+*	To get memory for a node from the allocator policy and construct a
+*	node holding the data in it.
+*
+* Precondition:
+*	A template type of the data the node will hold.
+*
+* Postcondition:
+*	A pointer to the new node, not yet linked into the list, is
+*	returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+Node<T> * LinkedList<T, Allocator>::CreateNode(const T & data)
+{
+	void * memory = Allocator::template Allocate<Node<T>>();	//Uninitialized memory for node
+
+	try
+	{
+		return new (memory) Node<T>(data);
+	}
+	catch (...)
+	{
+		//Give memory back if copying the data failed
+		Allocator::template Deallocate<Node<T>>(memory);
+		throw;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To destroy a node and give its memory back to the allocator policy.
+*
+* Precondition:
+*	A node created by CreateNode() that is no longer linked into the
+*	list.
+*
+* Postcondition:
+*	The node is destroyed and its memory is released.
+**********************************************************************/
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::DestroyNode(Node<T> * node)
+{
+	node->~Node();
+	Allocator::template Deallocate<Node<T>>(node);
+}
+
 /**********************************************************************
 * Purpose:
 *	To display the data of each item in the list from the beginning of
@@ -592,8 +1042,8 @@ void LinkedList<T>::Extract(const T & data)
 * Postcondition:
 *	The data of each item in the list is displayed.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::PrintForwards()
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::PrintForwards()
 {
 	//Traveling pointer to traverse list
 	Node<T> * travel = m_head;
@@ -619,8 +1069,8 @@ void LinkedList<T>::PrintForwards()
 * Postcondition:
 *	The data of each item in the list is displayed.
 **********************************************************************/
-template<typename T>
-void LinkedList<T>::PrintBackwards()
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::PrintBackwards()
 {
 	//Traveling pointer to traverse list from back to front
 	Node<T> * travelReverse = m_tail;
@@ -635,4 +1085,195 @@ void LinkedList<T>::PrintBackwards()
 	}
 }
 
+/**********************************************************************
+* Purpose:
+*	To construct an Iterator that does not refer to any list.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::Iterator::Iterator() : m_node(nullptr), m_list(nullptr)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an Iterator that refers to a node of a list.
+*
+* Precondition:
+*	A node of the list (or nullptr for the end of the list) and the
+*	list it belongs to.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+template<typename T, typename Allocator>
+LinkedList<T, Allocator>::Iterator::Iterator(Node<T> * node, const LinkedList<T, Allocator> * list) : m_node(node), m_list(list)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To return a reference to the data the iterator refers to.
+*
+* Precondition:
+*	The iterator refers to an item in a list (not End()).
+*
+* Postcondition:
+*	A reference to the data is returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+T & LinkedList<T, Allocator>::Iterator::operator*() const
+{
+	return m_node->m_data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a pointer to the data the iterator refers to.
+*
+* Precondition:
+*	The iterator refers to an item in a list (not End()).
+*
+* Postcondition:
+*	A pointer to the data is returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+T * LinkedList<T, Allocator>::Iterator::operator->() const
+{
+	return &(m_node->m_data);
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the iterator to the next item in the list.
+*
+* Precondition:
+*	The iterator refers to an item in a list (not End()).
+*
+* Postcondition:
+*	The iterator refers to the next item, or End().
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator & LinkedList<T, Allocator>::Iterator::operator++()
+{
+	m_node = m_node->m_next;
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the iterator to the next item in the list and return its
+*	previous position.
+*
+* Precondition:
+*	The iterator refers to an item in a list (not End()).
+*
+* Postcondition:
+*	The iterator refers to the next item, and a copy of the iterator
+*	from before it moved is returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::Iterator::operator++(int)
+{
+	Iterator previous = *this;	//Position before moving
+
+	m_node = m_node->m_next;
+
+	return previous;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the iterator to the previous item in the list. Moving back
+*	from End() goes to the last item.
+*
+* Precondition:
+*	The iterator does not refer to the first item.
+*
+* Postcondition:
+*	The iterator refers to the previous item.
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator & LinkedList<T, Allocator>::Iterator::operator--()
+{
+	m_node = (m_node == nullptr) ? m_list->m_tail : m_node->m_previous;
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the iterator to the previous item in the list and return
+*	its previous position.
+*
+* Precondition:
+*	The iterator does not refer to the first item.
+*
+* Postcondition:
+*	The iterator refers to the previous item, and a copy of the
+*	iterator from before it moved is returned.
+**********************************************************************/
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::Iterator LinkedList<T, Allocator>::Iterator::operator--(int)
+{
+	Iterator previous = *this;	//Position before moving
+
+	--(*this);
+
+	return previous;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if two iterators refer to the same item.
+*
+* Precondition:
+*	An existing Iterator passed by const ref.
+*
+* Postcondition:
+*	True is returned if both iterators refer to the same item.
+**********************************************************************/
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::Iterator::operator==(const Iterator & rhs) const
+{
+	return (m_node == rhs.m_node && m_list == rhs.m_list);
+}
+
+/**********************************************************************
+* Purpose:
+*	To check if two iterators refer to different items.
+*
+* Precondition:
+*	An existing Iterator passed by const ref.
+*
+* Postcondition:
+*	True is returned if the iterators refer to different items.
+**********************************************************************/
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::Iterator::operator!=(const Iterator & rhs) const
+{
+	return !(*this == rhs);
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the nodes of two lists (found by argument-dependent
+*	lookup, so generic code that calls swap uses LinkedList::Swap).
+*
+* Precondition:
+*	Two existing LinkedList objects passed by ref.
+*
+* Postcondition:
+*	Each list holds the nodes the other one held.
+**********************************************************************/
+template<typename T, typename Allocator>
+void swap(LinkedList<T, Allocator> & lhs, LinkedList<T, Allocator> & rhs) noexcept
+{
+	lhs.Swap(rhs);
+}
+
 #endif //LINKED_LIST_H
\ No newline at end of file
@@ -0,0 +1,558 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			move.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Move
+*
+* Purpose:
+*	This class describes one move of the Freecell game in four bytes:
+*	the kind of move, the index of the column or cell the card(s) come
+*	from, the index of the column or cell they go to, and the number of
+*	cards (more than one only for play area to play area moves). Moves
+*	are written into plain buffers by Board::GenerateMoves() and carried
+*	out by Board::MakeMove().
+*
+*	The count never exceeds 13, so its top bit is spare. MoveJournal
+*	uses it to flag moves made by AutoPlay(), so its records stay four
+*	bytes; the Board never sees the flag, since GetCount() masks it off.
+*
+* Manager functions:
+*	Move()
+*		Creates a move of one card from play area column 0 to play
+*		area column 0 (never legal), for filling buffers.
+*
+*	Move(MoveType type, int from, int to, int count = 1)
+*		Creates a move of the given kind between the given indices.
+*
+*	Move(const Move & copy)
+*
+*	~Move()
+*
+*	Move & operator=(const Move & rhs)
+*
+* Methods:
+*	bool operator==(const Move & rhs) const
+*		Checks if two moves are the same.
+*
+*	bool operator!=(const Move & rhs) const
+*		Checks if two moves differ.
+*
+*	MoveType GetType() const
+*		Returns the kind of move.
+*
+*	int GetFrom() const
+*		Returns the index of the column or free cell moved from.
+*
+*	int GetTo() const
+*		Returns the index of the column, free cell, or home cell moved
+*		to.
+*
+*	int GetCount() const
+*		Returns the number of cards moved.
+*
+*	bool IsAutomatic() const
+*		Returns true if the move is flagged as made by AutoPlay().
+*
+*	Move WithAutomatic(bool automatic) const
+*		Returns the same move with the automatic flag set or cleared.
+*
+* MoveStatus
+*	Whether Board allows a move (MOVE_OK) or why it does not. The
+*	CanMove* methods of Board return it instead of throwing.
+*
+* char * MoveStatusMessage(MoveStatus status)
+*	Returns the error message the Move* methods of Board throw for a
+*	status.
+*
+* Move rules
+*	One function per kind of move decides its MoveStatus from the
+*	cards involved, so Board and BoardState check moves with the same
+*	code and give the same reason for a move that is not allowed. An
+*	empty column or cell is passed as Card(NO_CARD_CODE).
+*
+*	int MaxMovableCards(int numEmptyFreeCells, int numEmptyColumns)
+*		Returns how many cards can move at once between columns.
+*
+*	MoveStatus CheckGoHome(const Card & card, const Card & homeTop)
+*		Checks whether a card may go on top of a home cell.
+*
+*	MoveStatus CheckPlayToPlay(int column1, int column2, int numCards,
+*		int maxMovable, int size, int runLength, const Card & runBottom,
+*		const Card & destTop)
+*	MoveStatus CheckPlayToFree(const Card & columnTop, const Card & freeCell)
+*	MoveStatus CheckPlayToHome(const Card & columnTop, const Card & homeTop)
+*	MoveStatus CheckFreeToPlay(const Card & freeCell, const Card & columnTop)
+*	MoveStatus CheckFreeToHome(const Card & freeCell, const Card & homeTop)
+*		Check a move of each kind.
+**********************************************************************/
+#ifndef MOVE_H
+#define MOVE_H
+
+#include "card.h"
+
+//Kinds of moves, in the order Board::GenerateMoves() writes them
+enum MoveType { PLAY_TO_HOME, FREE_TO_HOME, FREE_TO_PLAY, PLAY_TO_PLAY, PLAY_TO_FREE };
+
+const int NUM_MOVE_TYPES = 5;	//Number of kinds of moves
+
+//Filter bits for Board::GenerateMoves(), one per kind of move
+const int MOVE_FILTER_PLAY_TO_HOME = 1 << PLAY_TO_HOME;
+const int MOVE_FILTER_FREE_TO_HOME = 1 << FREE_TO_HOME;
+const int MOVE_FILTER_FREE_TO_PLAY = 1 << FREE_TO_PLAY;
+const int MOVE_FILTER_PLAY_TO_PLAY = 1 << PLAY_TO_PLAY;
+const int MOVE_FILTER_PLAY_TO_FREE = 1 << PLAY_TO_FREE;
+const int MOVE_FILTER_TO_HOME = MOVE_FILTER_PLAY_TO_HOME | MOVE_FILTER_FREE_TO_HOME;
+const int MOVE_FILTER_ALL = (1 << NUM_MOVE_TYPES) - 1;
+
+//Filter bit that keeps only the first of several empty destinations of the same kind,
+//since moving into any empty free cell, home cell, or column gives an equivalent board
+const int MOVE_FILTER_DISTINCT = 1 << NUM_MOVE_TYPES;
+
+const unsigned char MOVE_AUTOMATIC_FLAG = 0x80;	//Spare top bit of a Move's count, set for moves made by AutoPlay()
+
+//Whether a move is allowed, or why not
+enum MoveStatus
+{
+	MOVE_OK,						//The move is allowed
+	MOVE_NO_CARDS,					//Fewer than one card to move
+	MOVE_SAME_COLUMN,				//Moving from a column to itself
+	MOVE_TOO_MANY_CARDS,			//Not enough open cells to move that many cards
+	MOVE_NOT_ENOUGH_CARDS,			//More cards to move than the column has
+	MOVE_OUT_OF_ORDER,				//Cards to move are not all in order
+	MOVE_EMPTY_COLUMN,				//Moving from an empty play area column
+	MOVE_EMPTY_FREE_CELL,			//Moving from an empty free cell
+	MOVE_FILLED_FREE_CELL,			//Moving to a filled free cell
+	MOVE_NOT_ACE,					//Starting a home cell with a card other than an ace
+	MOVE_INVALID_COMBINATION,		//Card does not go on the card it is moved to
+	MOVE_INVALID_RUN_COMBINATION	//Bottom card of a run does not go on the card it is moved to
+};
+
+class Move
+{
+public:
+	//Default Ctor
+	Move();
+
+	//4-Arg Overloaded Ctor
+	Move(MoveType type, int from, int to, int count = 1);
+
+	//Copy Ctor (trivial, so Moves can be copied as raw bytes)
+	Move(const Move & copy) = default;
+
+	//Default Destructor
+	~Move() = default;
+
+	//Assignment Operator
+	Move & operator=(const Move & rhs) = default;
+
+	//Overloaded == Operator
+	bool operator==(const Move & rhs) const;
+
+	//Overloaded != Operator
+	bool operator!=(const Move & rhs) const;
+
+	//Getter for m_type
+	MoveType GetType() const;
+
+	//Getter for m_from
+	int GetFrom() const;
+
+	//Getter for m_to
+	int GetTo() const;
+
+	//Getter for m_count
+	int GetCount() const;
+
+	//Returns true if the move is flagged as automatic
+	bool IsAutomatic() const;
+
+	//Returns the move with the automatic flag set or cleared
+	Move WithAutomatic(bool automatic) const;
+
+private:
+	unsigned char m_type;	//Kind of move (a MoveType)
+	unsigned char m_from;	//Index of the column or free cell moved from
+	unsigned char m_to;		//Index of the column or cell moved to
+	unsigned char m_count;	//Number of cards moved, with MOVE_AUTOMATIC_FLAG for moves made by AutoPlay()
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct a placeholder Move.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to a one-card move from play area
+*	column 0 to play area column 0.
+**********************************************************************/
+inline Move::Move() : m_type(PLAY_TO_PLAY), m_from(0), m_to(0), m_count(1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a Move of a given kind.
+*
+* Precondition:
+*	The kind of move, the index moved from, the index moved to, and the
+*	number of cards moved.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+inline Move::Move(MoveType type, int from, int to, int count) :
+	m_type(static_cast<unsigned char>(type)), m_from(static_cast<unsigned char>(from)),
+	m_to(static_cast<unsigned char>(to)), m_count(static_cast<unsigned char>(count))
+{}
+
+/**********************************************************************
+* Purpose:
+*	To overload the == operator in order to compare two Moves.
+*
+* Precondition:
+*	An existing Move object passed by const ref.
+*
+* Postcondition:
+*	True is returned if both Moves are the same.
+**********************************************************************/
+inline bool Move::operator==(const Move & rhs) const
+{
+	return (m_type == rhs.m_type && m_from == rhs.m_from && m_to == rhs.m_to && m_count == rhs.m_count);
+}
+
+/**********************************************************************
+* Purpose:
+*	To overload the != operator in order to compare two Moves.
+*
+* Precondition:
+*	An existing Move object passed by const ref.
+*
+* Postcondition:
+*	True is returned if the Moves differ.
+**********************************************************************/
+inline bool Move::operator!=(const Move & rhs) const
+{
+	return !(*this == rhs);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the kind of move.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The kind of move is returned.
+**********************************************************************/
+inline MoveType Move::GetType() const
+{
+	return static_cast<MoveType>(m_type);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the index of the column or free cell moved from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index is returned.
+**********************************************************************/
+inline int Move::GetFrom() const
+{
+	return m_from;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the index of the column or cell moved to.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index is returned.
+**********************************************************************/
+inline int Move::GetTo() const
+{
+	return m_to;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of cards moved.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of cards is returned.
+**********************************************************************/
+inline int Move::GetCount() const
+{
+	return m_count & ~MOVE_AUTOMATIC_FLAG;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not the move is flagged as made by AutoPlay().
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if the automatic flag is set.
+**********************************************************************/
+inline bool Move::IsAutomatic() const
+{
+	return (m_count & MOVE_AUTOMATIC_FLAG) != 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a copy of the move with the automatic flag set or
+*	cleared. Moves that differ only in the flag are not equal, so
+*	flagged moves are cleared before they are compared or handed out.
+*
+* Precondition:
+*	Whether the move was made by AutoPlay().
+*
+* Postcondition:
+*	The flagged (or cleared) copy is returned.
+**********************************************************************/
+inline Move Move::WithAutomatic(bool automatic) const
+{
+	Move move(*this);	//Copy to flag
+
+	move.m_count = static_cast<unsigned char>(automatic ? (m_count | MOVE_AUTOMATIC_FLAG) : (m_count & ~MOVE_AUTOMATIC_FLAG));
+
+	return move;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the error message for a status of a move that is not
+*	allowed.
+*
+* Precondition:
+*	A MoveStatus.
+*
+* Postcondition:
+*	The message is returned.
+**********************************************************************/
+inline char * MoveStatusMessage(MoveStatus status)
+{
+	switch (status)
+	{
+		case MOVE_OK:
+			return "The move is allowed.";
+		case MOVE_NO_CARDS:
+			return "ERROR: Cannot move zero cards.";
+		case MOVE_SAME_COLUMN:
+			return "ERROR: Cannot move cards to the column they are in.";
+		case MOVE_TOO_MANY_CARDS:
+			return "ERROR: Not enough open cells to move that many cards.";
+		case MOVE_NOT_ENOUGH_CARDS:
+			return "ERROR: Cannot move more cards than are available.";
+		case MOVE_OUT_OF_ORDER:
+			return "ERROR: Not all cards to be moved are in the correct order.";
+		case MOVE_EMPTY_COLUMN:
+			return "ERROR: Cannot move from an empty play area column.";
+		case MOVE_EMPTY_FREE_CELL:
+			return "ERROR: Cannot move from an empty free cell.";
+		case MOVE_FILLED_FREE_CELL:
+			return "ERROR: Cannot put card in a filled free cell.";
+		case MOVE_NOT_ACE:
+			return "ERROR: Cannot place that card as the first one in a home cell.";
+		case MOVE_INVALID_COMBINATION:
+			return "ERROR: Cannot move card to that location. Invalid combination of cards.";
+		case MOVE_INVALID_RUN_COMBINATION:
+			return "ERROR: Cannot move card(s) to that location. Invalid combination of cards.";
+	}
+
+	return "ERROR: Unknown move status.";
+}
+
+/**********************************************************************
+* Purpose:
+*	To calculate the maximum number of cards that can be moved from
+*	play area to play area at one time.
+*
+* Precondition:
+*	The number of empty free cells and the number of empty play area
+*	columns, not counting the column the cards would move to.
+*
+* Postcondition:
+*	The maximum number of cards allowed to be moved is returned.
+**********************************************************************/
+inline int MaxMovableCards(int numEmptyFreeCells, int numEmptyColumns)
+{
+	//Each empty free cell holds one card, and each empty column doubles the run
+	return ((1 + numEmptyFreeCells) << numEmptyColumns);
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be put on top of a home cell: an ace
+*	on an empty home cell, or the next card of the same suit.
+*
+* Precondition:
+*	The card to move and the top card of the home cell, or
+*	Card(NO_CARD_CODE) if it is empty.
+*
+* Postcondition:
+*	MOVE_OK is returned if the card may go there, or the reason it may
+*	not.
+**********************************************************************/
+inline MoveStatus CheckGoHome(const Card & card, const Card & homeTop)
+{
+	//If desired home cell is empty, only an ACE may start it
+	if (homeTop.GetCode() == NO_CARD_CODE)
+		return (card.GetRank() == ACE) ? MOVE_OK : MOVE_NOT_ACE;
+
+	//If ranks are in order and suits are same (card to be added is one more than current top card of home cell)
+	if (!card.CanGoHomeAfter(homeTop))
+		return MOVE_INVALID_COMBINATION;
+
+	return MOVE_OK;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether card(s) may be moved from a play area column to a
+*	different play area column. The moved cards must be in order, there
+*	must be enough open cells to move them, and the bottom moved card
+*	must stack on the top card of the other column (unless it is
+*	empty).
+*
+* Precondition:
+*	The indices of the columns to move from and to, the number of
+*	cards to move, MaxMovableCards() for the column moved to, the
+*	number of cards in the column moved from, the length of the
+*	ordered run on top of it (it may stop counting at numCards), the
+*	bottom card to move (any card if numCards is not from 1 to
+*	runLength), and the top card of the column moved to.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+inline MoveStatus CheckPlayToPlay(int column1, int column2, int numCards, int maxMovable, int size, int runLength,
+	const Card & runBottom, const Card & destTop)
+{
+	if (numCards <= 0)
+		return MOVE_NO_CARDS;
+
+	if (column1 == column2)
+		return MOVE_SAME_COLUMN;
+
+	//Check number of cards allowed to be moved
+	if (numCards > maxMovable)
+		return MOVE_TOO_MANY_CARDS;
+
+	if (size == 0)
+		return MOVE_EMPTY_COLUMN;
+
+	//The moved cards must all be in the run on top of the column
+	if (numCards > runLength)
+		return (runLength == size) ? MOVE_NOT_ENOUGH_CARDS : MOVE_OUT_OF_ORDER;
+
+	//If column to move card(s) to is not empty, the bottom moved card must stack on its top card
+	if (destTop.GetCode() != NO_CARD_CODE && !runBottom.CanStackOn(destTop))
+		return MOVE_INVALID_RUN_COMBINATION;
+
+	return MOVE_OK;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a play area column to a
+*	free cell.
+*
+* Precondition:
+*	The top card of the column and the card in the free cell, each
+*	Card(NO_CARD_CODE) if empty.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+inline MoveStatus CheckPlayToFree(const Card & columnTop, const Card & freeCell)
+{
+	if (columnTop.GetCode() == NO_CARD_CODE)
+		return MOVE_EMPTY_COLUMN;
+
+	if (freeCell.GetCode() != NO_CARD_CODE)
+		return MOVE_FILLED_FREE_CELL;
+
+	return MOVE_OK;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a play area column to a
+*	home cell.
+*
+* Precondition:
+*	The top card of the column and the top card of the home cell, each
+*	Card(NO_CARD_CODE) if empty.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+inline MoveStatus CheckPlayToHome(const Card & columnTop, const Card & homeTop)
+{
+	if (columnTop.GetCode() == NO_CARD_CODE)
+		return MOVE_EMPTY_COLUMN;
+
+	return CheckGoHome(columnTop, homeTop);
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a free cell to a play
+*	area column.
+*
+* Precondition:
+*	The card in the free cell and the top card of the column, each
+*	Card(NO_CARD_CODE) if empty.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+inline MoveStatus CheckFreeToPlay(const Card & freeCell, const Card & columnTop)
+{
+	if (freeCell.GetCode() == NO_CARD_CODE)
+		return MOVE_EMPTY_FREE_CELL;
+
+	//If ranks are in order and suit colors are opposite (card to be added stacks on current top card of column)
+	if (columnTop.GetCode() != NO_CARD_CODE && !freeCell.CanStackOn(columnTop))
+		return MOVE_INVALID_COMBINATION;
+
+	return MOVE_OK;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a card may be moved from a free cell to a home
+*	cell.
+*
+* Precondition:
+*	The card in the free cell and the top card of the home cell, each
+*	Card(NO_CARD_CODE) if empty.
+*
+* Postcondition:
+*	MOVE_OK is returned if the move is allowed, or the reason it is not.
+**********************************************************************/
+inline MoveStatus CheckFreeToHome(const Card & freeCell, const Card & homeTop)
+{
+	if (freeCell.GetCode() == NO_CARD_CODE)
+		return MOVE_EMPTY_FREE_CELL;
+
+	return CheckGoHome(freeCell, homeTop);
+}
+
+#endif //MOVE_H
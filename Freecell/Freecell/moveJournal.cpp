@@ -0,0 +1,263 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			moveJournal.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "moveJournal.h"
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty MoveJournal.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+MoveJournal::MoveJournal() : m_current(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To record a move that was just made on the board. Moves that were
+*	undone can no longer be redone once a different move is made, so
+*	they are dropped (the journal keeps its capacity).
+*
+* Precondition:
+*	An existing Move object passed by const ref, just made on the
+*	board, and whether AutoPlay() made it.
+*
+* Postcondition:
+*	The move is the current move.
+**********************************************************************/
+void MoveJournal::Record(const Move & move, bool automatic)
+{
+	m_moves.resize(m_current);
+	m_moves.push_back(move.WithAutomatic(automatic));
+	m_current++;
+}
+
+/**********************************************************************
+* Purpose:
+*	To make a move on the board and record it.
+*
+* Precondition:
+*	A Board object passed by ref and a Move passed by const ref.
+*
+* Postcondition:
+*	The move is made and recorded, if allowed. An Exception is thrown
+*	(and nothing is recorded) if not.
+**********************************************************************/
+void MoveJournal::MakeMove(Board & board, const Move & move)
+{
+	board.MakeMove(move);
+	Record(move);
+}
+
+/**********************************************************************
+* Purpose:
+*	To reverse the current move on the board and step back to the
+*	move before it. The move is kept for Redo().
+*
+* Precondition:
+*	The Board object the moves were made on, passed by ref.
+*
+* Postcondition:
+*	The current move is undone, if there is one; else, an exception is
+*	thrown.
+**********************************************************************/
+void MoveJournal::Undo(Board & board)
+{
+	if (!CanUndo())
+		throw Exception("ERROR: There are no moves to undo.");
+
+	board.UndoMove(m_moves[--m_current]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To make the next recorded move on the board again and step forward
+*	to it.
+*
+* Precondition:
+*	The Board object the moves were made on, passed by ref.
+*
+* Postcondition:
+*	The next move is redone, if there is one; else, an exception is
+*	thrown.
+**********************************************************************/
+void MoveJournal::Redo(Board & board)
+{
+	if (!CanRedo())
+		throw Exception("ERROR: There are no moves to redo.");
+
+	board.MakeMove(m_moves[m_current++]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To send the cards that are safe to go home to the home cells and
+*	record them as automatic moves, so they are undone along with the
+*	move that let them go home.
+*
+* Precondition:
+*	The Board object the moves were made on, passed by ref.
+*
+* Postcondition:
+*	The safe cards are home and recorded, and the number of them is
+*	returned.
+**********************************************************************/
+int MoveJournal::AutoPlay(Board & board)
+{
+	Move moves[NUM_CARDS_DECK];	//Cards sent home, in order
+	int numMoves = board.AutoPlay(moves, NUM_CARDS_DECK);
+
+	for (int i = 0; i < numMoves; i++)
+		Record(moves[i], true);
+
+	return numMoves;
+}
+
+/**********************************************************************
+* Purpose:
+*	To take back a whole turn: the automatic moves at the end of the
+*	journal, then the move that led to them.
+*
+* Precondition:
+*	The Board object the moves were made on, passed by ref.
+*
+* Postcondition:
+*	The turn is undone, if there is a move to undo; else, an exception
+*	is thrown.
+**********************************************************************/
+void MoveJournal::UndoTurn(Board & board)
+{
+	if (!CanUndo())
+		throw Exception("ERROR: There are no moves to undo.");
+
+	//Stop after undoing a move that was not automatic
+	do
+	{
+		board.UndoMove(m_moves[--m_current]);
+	}
+	while (m_current > 0 && m_moves[m_current].IsAutomatic());
+}
+
+/**********************************************************************
+* Purpose:
+*	To make a whole turn again: the next move, then the automatic moves
+*	that followed it.
+*
+* Precondition:
+*	The Board object the moves were made on, passed by ref.
+*
+* Postcondition:
+*	The turn is redone, if there is a move to redo; else, an exception
+*	is thrown.
+**********************************************************************/
+void MoveJournal::RedoTurn(Board & board)
+{
+	if (!CanRedo())
+		throw Exception("ERROR: There are no moves to redo.");
+
+	do
+	{
+		board.MakeMove(m_moves[m_current++]);
+	}
+	while (m_current < m_moves.getLength() && m_moves[m_current].IsAutomatic());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not there is a move to undo.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if a move has been made and not undone.
+**********************************************************************/
+bool MoveJournal::CanUndo() const
+{
+	return (m_current > 0);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not there is a move to redo.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if a move has been undone and not replaced.
+**********************************************************************/
+bool MoveJournal::CanRedo() const
+{
+	return (m_current < m_moves.getLength());
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of moves made and not undone.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of moves is returned.
+**********************************************************************/
+int MoveJournal::GetNumMoves() const
+{
+	return m_current;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return one of the moves made and not undone.
+*
+* Precondition:
+*	An index from 0 (first move) to GetNumMoves() - 1 (current move).
+*
+* Postcondition:
+*	The move is returned.
+**********************************************************************/
+Move MoveJournal::GetMove(int index) const
+{
+	return m_moves[index].WithAutomatic(false);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not one of the moves made was made by
+*	AutoPlay().
+*
+* Precondition:
+*	An index from 0 (first move) to GetNumMoves() - 1 (current move).
+*
+* Postcondition:
+*	True is returned if the move is automatic.
+**********************************************************************/
+bool MoveJournal::IsAutomatic(int index) const
+{
+	return m_moves[index].IsAutomatic();
+}
+
+/**********************************************************************
+* Purpose:
+*	To forget every move, such as when a new game starts.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The journal is empty.
+**********************************************************************/
+void MoveJournal::Clear()
+{
+	m_moves.resize(0);
+	m_current = 0;
+}
@@ -0,0 +1,144 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			moveJournal.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: MoveJournal
+*
+* Purpose:
+*	This class records the moves made on a Board so they can be undone
+*	and redone. Each record is a four-byte Move, which is all
+*	Board::UndoMove() needs to put the cards back, and the records are
+*	kept in a single buffer, so going back or forward one move takes
+*	constant time and no copies of the board are kept. Moves after the
+*	current one stay in the journal for Redo() until a new move is
+*	recorded. The game uses it for its Undo and Redo actions, and a
+*	search can use MakeMove() and Undo() to walk down and back up its
+*	tree on a single board.
+*
+*	Cards sent home by AutoPlay() are recorded as automatic moves, with
+*	MOVE_AUTOMATIC_FLAG set in the record itself. A turn is one move
+*	made by the player followed by the automatic moves after it, and
+*	UndoTurn() and RedoTurn() step over a whole turn at once.
+*
+* Manager functions:
+*	MoveJournal()
+*		Creates an empty journal.
+*
+*	MoveJournal(const MoveJournal & copy)
+*
+*	~MoveJournal()
+*
+*	MoveJournal & operator=(const MoveJournal & rhs)
+*
+* Methods:
+*	void Record(const Move & move, bool automatic = false)
+*		Records a move just made on the board, dropping any moves that
+*		could have been redone.
+*
+*	void MakeMove(Board & board, const Move & move)
+*		Makes a move on the board and records it.
+*
+*	void Undo(Board & board)
+*		Reverses the current move on the board and steps back.
+*
+*	void Redo(Board & board)
+*		Makes the next recorded move again and steps forward.
+*
+*	int AutoPlay(Board & board)
+*		Sends the cards that are safe to go home to the home cells
+*		(see Board::AutoPlay()), records them as automatic moves, and
+*		returns how many were sent.
+*
+*	void UndoTurn(Board & board)
+*		Undoes the automatic moves at the end of the journal and the
+*		move before them.
+*
+*	void RedoTurn(Board & board)
+*		Redoes the next move and the automatic moves after it.
+*
+*	bool CanUndo() const
+*		Returns true if there is a move to undo.
+*
+*	bool CanRedo() const
+*		Returns true if there is a move to redo.
+*
+*	int GetNumMoves() const
+*		Returns the number of moves made and not undone.
+*
+*	Move GetMove(int index) const
+*		Returns one of the moves made and not undone, oldest first.
+*
+*	bool IsAutomatic(int index) const
+*		Returns true if one of the moves made was made by AutoPlay().
+*
+*	void Clear()
+*		Forgets every move.
+**********************************************************************/
+#ifndef MOVE_JOURNAL_H
+#define MOVE_JOURNAL_H
+
+#include "board.h"
+#include "array.h"
+
+class MoveJournal
+{
+	public:
+		//Default Ctor
+		MoveJournal();
+
+		//Copy Ctor
+		MoveJournal(const MoveJournal & copy) = default;
+
+		//Default Dtor
+		~MoveJournal() = default;
+
+		//Assignment Operator
+		MoveJournal & operator=(const MoveJournal & rhs) = default;
+
+		//Records a move just made on the board
+		void Record(const Move & move, bool automatic = false);
+
+		//Makes a move on the board and records it
+		void MakeMove(Board & board, const Move & move);
+
+		//Reverses the current move and steps back
+		void Undo(Board & board);
+
+		//Makes the next move again and steps forward
+		void Redo(Board & board);
+
+		//Sends safe cards home and records them as automatic moves
+		int AutoPlay(Board & board);
+
+		//Undoes the last move and the automatic moves after it
+		void UndoTurn(Board & board);
+
+		//Redoes the next move and the automatic moves after it
+		void RedoTurn(Board & board);
+
+		//Returns true if there is a move to undo
+		bool CanUndo() const;
+
+		//Returns true if there is a move to redo
+		bool CanRedo() const;
+
+		//Returns the number of moves made and not undone
+		int GetNumMoves() const;
+
+		//Returns a move made and not undone, oldest first
+		Move GetMove(int index) const;
+
+		//Returns true if a move was made by AutoPlay()
+		bool IsAutomatic(int index) const;
+
+		//Forgets every move
+		void Clear();
+
+	private:
+		Array<Move> m_moves;	//Moves made, followed by moves undone (flagged if made by AutoPlay())
+		int m_current;			//Number of moves made and not undone
+};
+
+#endif //MOVE_JOURNAL_H
@@ -33,7 +33,7 @@ class Node
 {
 private:
 	//LinkedList is a friend class to Node
-	template <typename T>
+	template <typename U, typename Allocator>
 	friend class LinkedList;
 
 	//Default Ctor
@@ -0,0 +1,509 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			nodePool.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: NodePool
+*
+* Purpose:
+*	This class is a slab allocator for objects of one type (such as
+*	Node<T>). Memory is taken from the heap in blocks of
+*	NODE_POOL_BLOCK_SLOTS objects, and freed objects go on a free list
+*	to be handed out again, so allocating and freeing a node is a
+*	couple of pointer moves and nodes that are used together sit next
+*	to each other in memory. Each thread has its own pool (see
+*	ThreadLocal()), so threads never contend for the same pool.
+*
+*	Every slot records the pool it came from, and a freed slot always
+*	goes back to that pool. A slot freed by its own pool's thread goes
+*	straight on the free list; one freed by another thread is pushed
+*	on the pool's lock-free remote list, which the owning thread takes
+*	over the next time its free list runs out. When a thread exits,
+*	its pool is only deleted once every slot it handed out has been
+*	freed, so nodes may outlive the thread that allocated them.
+*
+* Manager functions:
+*	NodePool()
+*		Creates an empty NodePool with no blocks.
+*
+*	~NodePool()
+*		Returns all of the pool's blocks to the heap.
+*
+* Methods:
+*	void * Allocate()
+*		Returns uninitialized memory for one object. Only the pool's
+*		own thread may call it.
+*
+*	static void Deallocate(void * memory)
+*		Puts memory for one object back in the pool it came from. Any
+*		thread may call it.
+*
+*	static NodePool<Type> & ThreadLocal()
+*		Returns the calling thread's own pool for this type.
+*
+* Class: HeapNodeAllocator
+*
+* Purpose:
+*	Allocator policy for LinkedList and StackLL that gets every node
+*	straight from the heap with new and delete. This is the default.
+*
+* Class: PooledNodeAllocator
+*
+* Purpose:
+*	Allocator policy for LinkedList and StackLL that gets nodes from
+*	the calling thread's NodePool. Nodes go back to the pool they came
+*	from, so a list filled on one thread may be emptied or destroyed on
+*	another (one thread at a time, like any list).
+*
+* Allocator policy methods:
+*	template <typename Type> static void * Allocate()
+*		Returns uninitialized memory for one object of the type.
+*
+*	template <typename Type> static void Deallocate(void * memory)
+*		Releases memory from Allocate() for one object of the type.
+**********************************************************************/
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+const int NODE_POOL_BLOCK_SLOTS = 256;	//Number of objects carved from each heap block
+
+template <typename Type>
+class NodePool
+{
+public:
+	//Returns memory for one object
+	void * Allocate();
+
+	//Puts memory for one object back in the pool it came from
+	static void Deallocate(void * memory);
+
+	//Returns the calling thread's pool
+	static NodePool<Type> & ThreadLocal();
+
+private:
+	//Default Ctor
+	NodePool();
+
+	//Default Dtor
+	~NodePool();
+
+	//Pools own raw memory and cannot be copied
+	NodePool(const NodePool<Type> & copy) = delete;
+	NodePool<Type> & operator=(const NodePool<Type> & rhs) = delete;
+
+	//Memory for one object, with the pool it belongs to
+	struct Slot
+	{
+		NodePool<Type> * m_owner;	//Pool that handed out the slot
+		union
+		{
+			Slot * m_next;	//Next unused slot in a free list
+			typename std::aligned_storage<sizeof(Type), alignof(Type)>::type m_storage;	//Memory for the object
+		};
+	};
+
+	//One heap allocation holding many slots
+	struct Block
+	{
+		Block * m_next;		//Next block owned by the pool
+		Slot m_slots[NODE_POOL_BLOCK_SLOTS];	//Slots carved from this block
+	};
+
+	//Creates the calling thread's pool and gives it up when the thread exits
+	struct ThreadHandle
+	{
+		ThreadHandle();
+		~ThreadHandle();
+
+		NodePool<Type> * m_pool;	//Pool owned by the thread
+	};
+
+	//Returns the calling thread's pool, nullptr if it has none
+	static NodePool<Type> *& Current();
+
+	//Takes a new block from the heap and adds its slots to the free list
+	void Grow();
+
+	//Puts a slot freed by another thread on the remote list
+	void FreeRemote(Slot * slot);
+
+	//Gives the pool up when its thread exits
+	void Orphan();
+
+	Slot * m_freeList;	//Unused slots, ready to hand out
+	Block * m_blocks;	//All blocks owned by the pool
+	int m_numBlocks;	//Number of blocks owned by the pool
+	std::atomic<Slot *> m_remoteFree;	//Slots freed by other threads, or &m_orphanMark once orphaned
+	std::atomic<int> m_orphanCount;		//Slots still in use after the thread exits, less those freed since
+	Slot m_orphanMark;	//Marks the remote list of a pool whose thread has exited
+};
+
+class HeapNodeAllocator
+{
+public:
+	//Returns memory for one object from the heap
+	template <typename Type>
+	static void * Allocate();
+
+	//Returns memory for one object to the heap
+	template <typename Type>
+	static void Deallocate(void * memory);
+};
+
+class PooledNodeAllocator
+{
+public:
+	//Returns memory for one object from the calling thread's pool
+	template <typename Type>
+	static void * Allocate();
+
+	//Returns memory for one object to the pool it came from
+	template <typename Type>
+	static void Deallocate(void * memory);
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty NodePool.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template <typename Type>
+NodePool<Type>::NodePool() : m_freeList(nullptr), m_blocks(nullptr), m_numBlocks(0),
+m_remoteFree(nullptr), m_orphanCount(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To return all of the pool's blocks to the heap and destroy the
+*	pool.
+*
+* Precondition:
+*	No objects allocated from the pool are still in use.
+*
+* Postcondition:
+*	All blocks are deleted and data members are reset to default
+*	values.
+**********************************************************************/
+template <typename Type>
+NodePool<Type>::~NodePool()
+{
+	//Delete each block
+	while (m_blocks != nullptr)
+	{
+		Block * next = m_blocks->m_next;
+		delete m_blocks;
+		m_blocks = next;
+	}
+
+	//Reset to default values
+	m_freeList = nullptr;
+	m_numBlocks = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return uninitialized memory for one object. When the free list
+*	is empty, the slots other threads have freed are taken over first,
+*	and a new block is taken from the heap only if there are none.
+*
+* Precondition:
+*	Called on the pool's own thread.
+*
+* Postcondition:
+*	Memory for one object is removed from the free list and returned.
+**********************************************************************/
+template <typename Type>
+void * NodePool<Type>::Allocate()
+{
+	//If no unused slots, take over those freed by other threads
+	if (m_freeList == nullptr)
+	{
+		m_freeList = m_remoteFree.exchange(nullptr, std::memory_order_acquire);
+
+		//If none, take a new block from the heap
+		if (m_freeList == nullptr)
+			Grow();
+	}
+
+	Slot * slot = m_freeList;	//Slot being handed out
+	m_freeList = slot->m_next;
+
+	return &(slot->m_storage);
+}
+
+/**********************************************************************
+* Purpose:
+*	To put memory for one object back in the pool that handed it out,
+*	so it can be handed out again. The pool's own thread puts it
+*	straight on the free list; any other thread pushes it on the
+*	pool's remote list.
+*
+* Precondition:
+*	Memory returned by Allocate() whose object has been destroyed.
+*
+* Postcondition:
+*	The memory is back in the pool it came from.
+**********************************************************************/
+template <typename Type>
+void NodePool<Type>::Deallocate(void * memory)
+{
+	Slot * slot = reinterpret_cast<Slot *>(static_cast<char *>(memory) - offsetof(Slot, m_storage));	//Slot being returned
+	NodePool<Type> * owner = slot->m_owner;	//Pool the slot came from
+
+	if (owner == Current())
+	{
+		slot->m_next = owner->m_freeList;
+		owner->m_freeList = slot;
+	}
+	else
+		owner->FreeRemote(slot);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the calling thread's own pool for this type, creating it
+*	the first time the thread asks for it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A reference to the calling thread's pool is returned.
+**********************************************************************/
+template <typename Type>
+NodePool<Type> & NodePool<Type>::ThreadLocal()
+{
+	thread_local ThreadHandle handle;	//One pool per thread per type
+
+	return *(handle.m_pool);
+}
+
+/**********************************************************************
+* Purpose:
+*	To create the calling thread's pool and make it the thread's
+*	current pool.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The thread has a new, empty pool.
+**********************************************************************/
+template <typename Type>
+NodePool<Type>::ThreadHandle::ThreadHandle() : m_pool(new NodePool<Type>)
+{
+	Current() = m_pool;
+}
+
+/**********************************************************************
+* Purpose:
+*	To give up the calling thread's pool when the thread exits. Slots
+*	freed on this thread afterward go through the remote list.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The thread has no pool, and the pool is deleted once all of its
+*	slots have been freed.
+**********************************************************************/
+template <typename Type>
+NodePool<Type>::ThreadHandle::~ThreadHandle()
+{
+	Current() = nullptr;
+	m_pool->Orphan();
+	m_pool = nullptr;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the calling thread's current pool. The pointer has no
+*	destructor, so it can still be read while the thread's other
+*	thread_local objects are being destroyed.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A reference to the thread's pool pointer is returned, nullptr if
+*	the thread has no pool.
+**********************************************************************/
+template <typename Type>
+NodePool<Type> *& NodePool<Type>::Current()
+{
+	thread_local NodePool<Type> * current = nullptr;	//Pool of the calling thread
+
+	return current;
+}
+
+/**********************************************************************
+* Purpose:
+*	To take a new block from the heap and link all of its slots into
+*	the free list in address order, so consecutive allocations are
+*	next to each other in memory.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The free list holds NODE_POOL_BLOCK_SLOTS more slots.
+**********************************************************************/
+template <typename Type>
+void NodePool<Type>::Grow()
+{
+	Block * block = new Block;	//New block of slots
+
+	block->m_next = m_blocks;
+	m_blocks = block;
+	m_numBlocks++;
+
+	//Link slots in reverse so the free list hands them out in address order
+	for (int i = NODE_POOL_BLOCK_SLOTS - 1; i >= 0; i--)
+	{
+		block->m_slots[i].m_owner = this;
+		block->m_slots[i].m_next = m_freeList;
+		m_freeList = &(block->m_slots[i]);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To put a slot freed by another thread on the remote list, where
+*	the owning thread picks it up. If the owning thread has exited,
+*	the slot is counted off instead, and the last slot to be freed
+*	deletes the pool.
+*
+* Precondition:
+*	A slot of this pool whose object has been destroyed.
+*
+* Postcondition:
+*	The slot is on the remote list, or counted off an orphaned pool.
+**********************************************************************/
+template <typename Type>
+void NodePool<Type>::FreeRemote(Slot * slot)
+{
+	Slot * head = m_remoteFree.load(std::memory_order_relaxed);	//Current front of the remote list
+
+	do
+	{
+		//If owning thread has exited, count slot off and delete pool after the last one
+		if (head == &m_orphanMark)
+		{
+			if (m_orphanCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
+
+			return;
+		}
+
+		slot->m_next = head;
+	} while (!m_remoteFree.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**********************************************************************
+* Purpose:
+*	To give up the pool when its thread exits. The remote list is
+*	closed, and the slots still in use are counted; the pool is
+*	deleted now if there are none, or else by the last FreeRemote().
+*
+* Precondition:
+*	Called once, by the pool's own thread.
+*
+* Postcondition:
+*	The pool is deleted, or will be when its last slot is freed.
+**********************************************************************/
+template <typename Type>
+void NodePool<Type>::Orphan()
+{
+	Slot * remote = m_remoteFree.exchange(&m_orphanMark, std::memory_order_acq_rel);	//Slots other threads freed
+	int inUse = m_numBlocks * NODE_POOL_BLOCK_SLOTS;	//Slots handed out and not yet freed
+
+	//Count off unused slots
+	for (Slot * slot = m_freeList; slot != nullptr; slot = slot->m_next)
+		inUse--;
+
+	for (Slot * slot = remote; slot != nullptr; slot = slot->m_next)
+		inUse--;
+
+	//Slots freed since the list closed have already been counted off
+	if (m_orphanCount.fetch_add(inUse, std::memory_order_acq_rel) + inUse == 0)
+		delete this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return uninitialized memory for one object from the heap.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Memory for one object is returned.
+**********************************************************************/
+template <typename Type>
+void * HeapNodeAllocator::Allocate()
+{
+	return ::operator new(sizeof(Type));
+}
+
+/**********************************************************************
+* Purpose:
+*	To return memory for one object to the heap.
+*
+* Precondition:
+*	Memory returned by Allocate() whose object has been destroyed.
+*
+* Postcondition:
+*	The memory is freed.
+**********************************************************************/
+template <typename Type>
+void HeapNodeAllocator::Deallocate(void * memory)
+{
+	::operator delete(memory);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return uninitialized memory for one object from the calling
+*	thread's pool.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Memory for one object is returned.
+**********************************************************************/
+template <typename Type>
+void * PooledNodeAllocator::Allocate()
+{
+	return NodePool<Type>::ThreadLocal().Allocate();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return memory for one object to the pool it came from, which
+*	need not be the calling thread's.
+*
+* Precondition:
+*	Memory returned by Allocate() whose object has been destroyed.
+*
+* Postcondition:
+*	The memory is back in the pool it came from.
+**********************************************************************/
+template <typename Type>
+void PooledNodeAllocator::Deallocate(void * memory)
+{
+	NodePool<Type>::Deallocate(memory);
+}
+
+#endif //NODE_POOL_H
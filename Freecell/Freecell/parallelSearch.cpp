@@ -0,0 +1,757 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			parallelSearch.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "parallelSearch.h"
+
+#include <climits>
+#include <thread>
+
+/**********************************************************************
+* Purpose:
+*	To construct a placeholder SolverTask, for filling arrays.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to an empty key with no parent.
+**********************************************************************/
+SolverTask::SolverTask() : m_parentWorker(-1), m_parentStep(-1), m_priority(0), m_depth(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a SolverTask for a position reached by a move.
+*
+* Precondition:
+*	The key of the position, the worker and step it was reached from,
+*	the move that reached it, its priority, and the number of moves
+*	that reached it.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+SolverTask::SolverTask(const BoardKey & key, int parentWorker, int parentStep, const Move & move, int priority, int depth) :
+	m_key(key), m_parentWorker(parentWorker), m_parentStep(parentStep), m_move(move), m_priority(priority), m_depth(depth)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To overload the < operator in order to order a worker's queue.
+*
+* Precondition:
+*	An existing SolverTask object passed by const ref.
+*
+* Postcondition:
+*	True is returned if this task has the lower priority, or the same
+*	priority and more moves made (which keeps the search going deeper).
+**********************************************************************/
+bool SolverTask::operator<(const SolverTask & rhs) const
+{
+	return (m_priority < rhs.m_priority || (m_priority == rhs.m_priority && m_depth > rhs.m_depth));
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the key of the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+const BoardKey & SolverTask::GetKey() const
+{
+	return m_key;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the worker that expanded the position this one was
+*	reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index of the worker is returned, or -1 for the start.
+**********************************************************************/
+int SolverTask::GetParentWorker() const
+{
+	return m_parentWorker;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the step of that worker this position was reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index of the step is returned, or -1 for the start.
+**********************************************************************/
+int SolverTask::GetParentStep() const
+{
+	return m_parentStep;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the move that reached the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The move is returned.
+**********************************************************************/
+Move SolverTask::GetMove() const
+{
+	return m_move;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of moves that reached the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of moves is returned.
+**********************************************************************/
+int SolverTask::GetDepth() const
+{
+	return m_depth;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a placeholder SolverStep, for filling arrays.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to a step with no parent.
+**********************************************************************/
+SolverStep::SolverStep() : m_parentWorker(-1), m_parentStep(-1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a SolverStep for an expanded position.
+*
+* Precondition:
+*	The worker and step the position was reached from, and the move
+*	that reached it.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+SolverStep::SolverStep(int parentWorker, int parentStep, const Move & move) :
+	m_parentWorker(parentWorker), m_parentStep(parentStep), m_move(move)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To return the worker that expanded the position this one was
+*	reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index of the worker is returned, or -1 for the start.
+**********************************************************************/
+int SolverStep::GetParentWorker() const
+{
+	return m_parentWorker;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the step of that worker this position was reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index of the step is returned, or -1 for the start.
+**********************************************************************/
+int SolverStep::GetParentStep() const
+{
+	return m_parentStep;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the move that reached the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The move is returned.
+**********************************************************************/
+Move SolverStep::GetMove() const
+{
+	return m_move;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a SolverWorker with nothing queued.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The queue and steps are empty and there is no best position.
+**********************************************************************/
+SolverWorker::SolverWorker() : m_bestScore(INT_MAX), m_bestStep(-1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To add tasks to the worker's queue, holding its lock once for all
+*	of them.
+*
+* Precondition:
+*	An array of tasks and the number of them.
+*
+* Postcondition:
+*	The tasks are in the queue.
+**********************************************************************/
+void SolverWorker::Push(const SolverTask tasks[], int numTasks)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	for (int i = 0; i < numTasks; i++)
+		m_queue.Push(tasks[i]);
+}
+
+/**********************************************************************
+* Purpose:
+*	To take the most promising task from the worker's queue.
+*
+* Precondition:
+*	A SolverTask passed by ref to receive the task.
+*
+* Postcondition:
+*	True is returned and the task is removed from the queue, if the
+*	queue was not empty; else, false is returned.
+**********************************************************************/
+bool SolverWorker::Pop(SolverTask & task)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+
+	if (m_queue.isEmpty())
+		return false;
+
+	task = m_queue.Pop();
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To take the most promising tasks from the worker's queue for
+*	another worker: half of the queue (rounded up), but no more than
+*	the limit, so the worker keeps the rest of its work.
+*
+* Precondition:
+*	An array to receive the tasks and the most it can hold.
+*
+* Postcondition:
+*	The tasks are removed from the queue and written into the array,
+*	most promising first, and the number of them is returned.
+**********************************************************************/
+int SolverWorker::Steal(SolverTask tasks[], int maxTasks)
+{
+	std::lock_guard<std::mutex> guard(m_lock);
+	int numTasks = (m_queue.Size() + 1) / 2;	//Number of tasks to take
+
+	if (numTasks > maxTasks)
+		numTasks = maxTasks;
+
+	for (int i = 0; i < numTasks; i++)
+		tasks[i] = m_queue.Pop();
+
+	return numTasks;
+}
+
+/**********************************************************************
+* Purpose:
+*	To write down a position the worker has expanded.
+*
+* Precondition:
+*	The step, written only from the worker's own thread.
+*
+* Postcondition:
+*	The step is added and its index is returned.
+**********************************************************************/
+int SolverWorker::AddStep(const SolverStep & step)
+{
+	m_steps.push_back(step);
+
+	return m_steps.getLength() - 1;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a position the worker has expanded.
+*
+* Precondition:
+*	The index of a step. Only read once the worker's thread has
+*	stopped.
+*
+* Postcondition:
+*	The step is returned.
+**********************************************************************/
+const SolverStep & SolverWorker::GetStep(int index) const
+{
+	return m_steps[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of positions the worker has expanded.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of steps is returned.
+**********************************************************************/
+int SolverWorker::GetNumSteps() const
+{
+	return m_steps.getLength();
+}
+
+/**********************************************************************
+* Purpose:
+*	To keep a queued position as the worker's best, if its estimate is
+*	lower than that of every position the worker queued before.
+*
+* Precondition:
+*	The position's estimate (see Solver::Evaluate()), the step it was
+*	reached from, and the move that reached it.
+*
+* Postcondition:
+*	The best position is updated if the estimate is the lowest yet.
+**********************************************************************/
+void SolverWorker::OfferBest(int score, int step, const Move & move)
+{
+	if (score < m_bestScore)
+	{
+		m_bestScore = score;
+		m_bestStep = step;
+		m_bestMove = move;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the estimate of the worker's best position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The estimate is returned, INT_MAX if there is no best position.
+**********************************************************************/
+int SolverWorker::GetBestScore() const
+{
+	return m_bestScore;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the step the worker's best position was reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index of the step is returned, -1 if there is no best position.
+**********************************************************************/
+int SolverWorker::GetBestStep() const
+{
+	return m_bestStep;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the move that reached the worker's best position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The move is returned.
+**********************************************************************/
+Move SolverWorker::GetBestMove() const
+{
+	return m_bestMove;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a ParallelSearch. A quarter of the memory limit is
+*	meant for the shared table, which the caller keeps, and the rest
+*	goes to the tasks and steps of the workers.
+*
+* Precondition:
+*	The number of workers (at least one), the most positions they may
+*	expand in all, the most bytes they may use, the most milliseconds
+*	they may run (zero for no limit), and the table to share.
+*
+* Postcondition:
+*	Every worker's queue is empty.
+**********************************************************************/
+ParallelSearch::ParallelSearch(int numThreads, int nodeLimit, size_t memoryLimit, int timeLimit,
+	SharedTranspositionTable & table) :
+	m_numThreads(numThreads), m_nodeLimit(nodeLimit), m_maxNodes(INT_MAX), m_timeLimit(timeLimit),
+	m_workers(new SolverWorker[numThreads]),
+	m_table(table),
+	m_nodesExpanded(0), m_nodesStored(0), m_pending(0), m_stopped(false), m_status(SOLVE_UNSOLVABLE),
+	m_winWorker(-1), m_winStep(-1)
+{
+	size_t maxNodes = memoryLimit / 4 * 3 / (sizeof(SolverTask) + sizeof(SolverStep));	//Positions the rest allows
+
+	if (maxNodes < static_cast<size_t>(INT_MAX))
+		m_maxNodes = static_cast<int>(maxNodes);
+}
+
+/**********************************************************************
+* Purpose:
+*	To search for a win from a board. The cards that are safe to go
+*	home go first, the table starts a new search, the starting position
+*	is queued on the first worker, and every worker's thread runs until
+*	the search ends. The winning moves, or the moves to the best
+*	position of every worker, are then found by walking back through
+*	the steps.
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref.
+*	Run() is called once per ParallelSearch.
+*
+* Postcondition:
+*	SOLVE_SOLVED is returned and GetPath() holds the moves to the win,
+*	if a win was found; else, GetBestPath() holds the moves to the best
+*	position and the reason the search ended is returned.
+**********************************************************************/
+SolveStatus ParallelSearch::Run(const Board & board)
+{
+	Board start = board;	//Starting position after the safe cards go home
+	std::unique_ptr<std::thread[]> threads(new std::thread[m_numThreads]);	//Thread of each worker
+
+	start.AutoPlay();
+
+	if (start.WonGame())
+		return SOLVE_SOLVED;
+
+	SolverTask root(BoardKey(start), -1, -1, Move(), Solver::Evaluate(start), 0);	//Starting position
+
+	m_table.NewSearch();
+	m_table.Insert(start.GetCanonicalHash(), 0);
+	m_workers[0].Push(&root, 1);
+	m_nodesStored = 1;
+	m_pending = 1;
+	m_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_timeLimit);
+
+	for (int i = 0; i < m_numThreads; i++)
+		threads[i] = std::thread(&ParallelSearch::Work, this, i);
+
+	for (int i = 0; i < m_numThreads; i++)
+		threads[i].join();
+
+	if (m_status == SOLVE_SOLVED)
+		CollectPath(m_winWorker, m_winStep, m_winMove, m_path);
+	else
+	{
+		int best = 0;	//Worker with the best position
+
+		for (int i = 1; i < m_numThreads; i++)
+		{
+			if (m_workers[i].GetBestScore() < m_workers[best].GetBestScore())
+				best = i;
+		}
+
+		if (m_workers[best].GetBestStep() >= 0)
+			CollectPath(best, m_workers[best].GetBestStep(), m_workers[best].GetBestMove(), m_bestPath);
+	}
+
+	return m_status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the moves that reach the win.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The moves are returned, last first, without the cards sent home
+*	automatically. They are empty if no win was found (or the start
+*	was won by sending cards home).
+**********************************************************************/
+const Array<Move> & ParallelSearch::GetPath() const
+{
+	return m_path;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the moves that reach the most promising position queued.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The moves are returned, last first, without the cards sent home
+*	automatically. They are empty if a win was found or no position
+*	was queued after the start.
+**********************************************************************/
+const Array<Move> & ParallelSearch::GetBestPath() const
+{
+	return m_bestPath;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of positions expanded by every worker.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of positions is returned, no more than the node limit.
+**********************************************************************/
+int ParallelSearch::GetNodesExpanded() const
+{
+	return (m_nodesExpanded < m_nodeLimit) ? m_nodesExpanded.load() : m_nodeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of positions queued by every worker.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of positions is returned.
+**********************************************************************/
+int ParallelSearch::GetNodesStored() const
+{
+	return m_nodesStored;
+}
+
+/**********************************************************************
+* Purpose:
+*	To expand positions on one worker until the search ends. The
+*	worker takes the most promising task of its own queue, or steals
+*	some if its queue is empty, and makes and takes back every legal
+*	move from it like the one-thread search. The new positions are
+*	counted as pending before the task is counted as done, so the
+*	pending count only reaches zero when there is no work left
+*	anywhere.
+*
+* Precondition:
+*	The index of the worker, called on its own thread.
+*
+* Postcondition:
+*	The search has ended.
+**********************************************************************/
+void ParallelSearch::Work(int worker)
+{
+	Board current;								//Position being expanded
+	Move moves[MAX_LEGAL_MOVES];				//Legal moves from the current position
+	Move autoMoves[NUM_CARDS_DECK];				//Cards sent home after a move
+	Array<SolverTask> children(MAX_LEGAL_MOVES);	//New positions reached from the current one
+	SolverTask task;							//Task being expanded
+	int sinceClock = 0;							//Tasks expanded since the clock was looked at
+
+	while (!m_stopped)
+	{
+		if (!m_workers[worker].Pop(task) && !StealWork(worker, task))
+		{
+			//No work anywhere and no worker making more means nothing is left to search
+			if (m_pending == 0)
+				Stop(SOLVE_UNSOLVABLE);
+			else
+				std::this_thread::yield();
+
+			continue;
+		}
+
+		if (++m_nodesExpanded > m_nodeLimit)
+		{
+			Stop(SOLVE_NODE_LIMIT);
+			return;
+		}
+
+		if (m_timeLimit > 0 && ++sinceClock >= SOLVER_CLOCK_INTERVAL)
+		{
+			sinceClock = 0;
+
+			if (std::chrono::steady_clock::now() >= m_deadline)
+			{
+				Stop(SOLVE_TIME_LIMIT);
+				return;
+			}
+		}
+
+		int step = m_workers[worker].AddStep(SolverStep(task.GetParentWorker(), task.GetParentStep(), task.GetMove()));
+		int numMoves = 0;		//Number of legal moves from the current position
+		int numChildren = 0;	//Number of new positions reached from it
+
+		task.GetKey().Decode(current);
+		numMoves = current.GenerateMoves(moves, MAX_LEGAL_MOVES, MOVE_FILTER_ALL | MOVE_FILTER_DISTINCT);
+
+		for (int i = 0; i < numMoves; i++)
+		{
+			current.MakeMove(moves[i]);
+
+			int numAutoMoves = current.AutoPlay(autoMoves, NUM_CARDS_DECK);	//Cards sent home after the move
+
+			if (current.WonGame())
+			{
+				std::lock_guard<std::mutex> guard(m_stopLock);
+
+				if (!m_stopped)
+				{
+					m_status = SOLVE_SOLVED;
+					m_winWorker = worker;
+					m_winStep = step;
+					m_winMove = moves[i];
+					m_stopped = true;
+				}
+
+				return;
+			}
+
+			if (m_table.Insert(current.GetCanonicalHash(), task.GetDepth() + 1))
+			{
+				int score = Solver::Evaluate(current);	//Estimated moves left to a win
+
+				m_workers[worker].OfferBest(score, step, moves[i]);
+				children[numChildren++] = SolverTask(BoardKey(current), worker, step, moves[i],
+					score + task.GetDepth() + 1, task.GetDepth() + 1);
+			}
+
+			//Take the move back for the next one
+			while (numAutoMoves > 0)
+				current.UndoMove(autoMoves[--numAutoMoves]);
+
+			current.UndoMove(moves[i]);
+		}
+
+		if (numChildren > 0)
+		{
+			if (m_nodesStored.fetch_add(numChildren) + numChildren > m_maxNodes)
+			{
+				Stop(SOLVE_MEMORY_LIMIT);
+				return;
+			}
+
+			m_pending += numChildren;
+			m_workers[worker].Push(&children[0], numChildren);
+		}
+
+		m_pending--;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To take tasks from another worker's queue, trying each other
+*	worker in turn starting after this one. The most promising stolen
+*	task is expanded next and the rest go in this worker's queue.
+*
+* Precondition:
+*	The index of the worker and a SolverTask passed by ref to receive
+*	the task to expand.
+*
+* Postcondition:
+*	True is returned if tasks were stolen; else, false is returned.
+**********************************************************************/
+bool ParallelSearch::StealWork(int worker, SolverTask & task)
+{
+	SolverTask stolen[SOLVER_STEAL_CHUNK];	//Tasks taken, most promising first
+
+	for (int i = 1; i < m_numThreads; i++)
+	{
+		int numStolen = m_workers[(worker + i) % m_numThreads].Steal(stolen, SOLVER_STEAL_CHUNK);
+
+		if (numStolen > 0)
+		{
+			task = stolen[0];
+			m_workers[worker].Push(stolen + 1, numStolen - 1);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**********************************************************************
+* Purpose:
+*	To end the search, recording why, unless it has already ended (a
+*	win found by one worker is not replaced by a limit another worker
+*	reaches afterwards).
+*
+* Precondition:
+*	The reason the search ends.
+*
+* Postcondition:
+*	The search is flagged as ended.
+**********************************************************************/
+void ParallelSearch::Stop(SolveStatus status)
+{
+	std::lock_guard<std::mutex> guard(m_stopLock);
+
+	if (!m_stopped)
+	{
+		m_status = status;
+		m_stopped = true;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To collect the moves that reach a position, given the step it was
+*	reached from and the move made from there, by walking back through
+*	the steps of every worker.
+*
+* Precondition:
+*	The worker and step the position was reached from, the move that
+*	reached it, and a path passed by ref. Every thread has stopped.
+*
+* Postcondition:
+*	The moves are added to the end of the path, last first.
+**********************************************************************/
+void ParallelSearch::CollectPath(int worker, int step, const Move & move, Array<Move> & path) const
+{
+	path.push_back(move);
+
+	//The starting position's step has no parent and no move of its own
+	while (m_workers[worker].GetStep(step).GetParentStep() >= 0)
+	{
+		const SolverStep & current = m_workers[worker].GetStep(step);
+
+		path.push_back(current.GetMove());
+		worker = current.GetParentWorker();
+		step = current.GetParentStep();
+	}
+}
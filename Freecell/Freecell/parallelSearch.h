@@ -0,0 +1,280 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			parallelSearch.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: ParallelSearch
+*
+* Purpose:
+*	This class runs the Solver's best-first search on several threads
+*	at once. Each thread (worker) has its own queue of positions and
+*	expands the most promising one in it, like the one-thread search.
+*	A worker whose queue runs dry steals the most promising chunk of
+*	another worker's queue, so every thread keeps busy with good
+*	positions without a single shared queue to wait on. The positions
+*	already reached are shared through a lock-free
+*	SharedTranspositionTable of fixed size, so the workers rarely
+*	expand the same position twice and never wait for each other to
+*	check. A position reached again in fewer moves is expanded again.
+*
+*	Each queued position (a SolverTask) carries its own BoardKey, so a
+*	stolen task needs nothing from the worker it came from. When a
+*	worker expands a task it writes down a SolverStep (the position it
+*	came from and the move that reached it) in its own list, and the
+*	winning moves are found by walking back through the steps of every
+*	worker once the threads have stopped.
+*
+*	The search ends when a worker wins, when the shared node count
+*	reaches the node limit, when the positions queued would pass the
+*	memory limit, when the time limit (if any) runs out, or when every
+*	queue is empty and no worker is busy. Each worker keeps the most
+*	promising position it has queued, and if no worker wins, the best
+*	of these is walked back to like a win.
+*	The table replaces old positions instead of filling up, so with a
+*	small memory limit a board that cannot be won may end at a limit
+*	rather than be shown unwinnable.
+*	Which of several equally good wins is found depends on how the
+*	threads happen to run; Solver uses its one-thread search instead
+*	when it is given one thread, which always gives the same result.
+*
+* Manager functions:
+*	ParallelSearch(int numThreads, int nodeLimit, size_t memoryLimit,
+*		int timeLimit, SharedTranspositionTable & table)
+*		Creates a search with the given number of workers and limits
+*		(a time limit of zero for none), using the table (which Run()
+*		starts a new search in).
+*
+* Methods:
+*	SolveStatus Run(const Board & board)
+*		Searches for a win from the board on every worker and returns
+*		how the search ended.
+*
+*	const Array<Move> & GetPath() const
+*		Returns the moves (not counting the cards sent home
+*		automatically) that reach the win, last first.
+*
+*	const Array<Move> & GetBestPath() const
+*		Returns the moves (not counting the cards sent home
+*		automatically) that reach the most promising position queued,
+*		last first, if no win was found.
+*
+*	int GetNodesExpanded() const
+*		Returns the number of positions expanded by every worker.
+*
+*	int GetNodesStored() const
+*		Returns the number of positions queued by every worker.
+*
+* Class: SolverTask
+*
+* Purpose:
+*	One position waiting in a worker's queue: its BoardKey, the step
+*	it was reached from (worker and index, -1 for the start), the move
+*	that reached it, its priority, and the number of moves that reached
+*	it. Lower priorities come first.
+*
+* Class: SolverStep
+*
+* Purpose:
+*	One position a worker has expanded: the step it was reached from
+*	and the move that reached it.
+*
+* Class: SolverWorker
+*
+* Purpose:
+*	One worker's queue of SolverTasks and list of SolverSteps, and the
+*	most promising position it has queued. The queue is locked for
+*	each push, pop, and steal, since other workers steal from it; the
+*	steps and the best position are only written by the worker's own
+*	thread and only read after every thread has stopped.
+**********************************************************************/
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+#include "solver.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <memory>
+
+const int SOLVER_STEAL_CHUNK = 32;	//Most tasks taken from another worker at once
+
+class SolverTask
+{
+public:
+	//Default Ctor
+	SolverTask();
+
+	//6-Arg Overloaded Ctor
+	SolverTask(const BoardKey & key, int parentWorker, int parentStep, const Move & move, int priority, int depth);
+
+	//Overloaded < Operator
+	bool operator<(const SolverTask & rhs) const;
+
+	//Getter for m_key
+	const BoardKey & GetKey() const;
+
+	//Getter for m_parentWorker
+	int GetParentWorker() const;
+
+	//Getter for m_parentStep
+	int GetParentStep() const;
+
+	//Getter for m_move
+	Move GetMove() const;
+
+	//Getter for m_depth
+	int GetDepth() const;
+
+private:
+	BoardKey m_key;			//Position
+	int m_parentWorker;		//Worker that expanded the position it was reached from
+	int m_parentStep;		//Step of that worker, -1 for the start
+	Move m_move;			//Move that reached it
+	int m_priority;			//Estimated moves to a win through the position
+	int m_depth;			//Moves made to reach the position
+};
+
+class SolverStep
+{
+public:
+	//Default Ctor
+	SolverStep();
+
+	//3-Arg Overloaded Ctor
+	SolverStep(int parentWorker, int parentStep, const Move & move);
+
+	//Getter for m_parentWorker
+	int GetParentWorker() const;
+
+	//Getter for m_parentStep
+	int GetParentStep() const;
+
+	//Getter for m_move
+	Move GetMove() const;
+
+private:
+	int m_parentWorker;		//Worker that expanded the position it was reached from
+	int m_parentStep;		//Step of that worker, -1 for the start
+	Move m_move;			//Move that reached it
+};
+
+class SolverWorker
+{
+public:
+	//Default Ctor
+	SolverWorker();
+
+	//Copy Ctor (not allowed, the lock cannot be copied)
+	SolverWorker(const SolverWorker & copy) = delete;
+
+	//Default Dtor
+	~SolverWorker() = default;
+
+	//Assignment Operator (not allowed, the lock cannot be copied)
+	SolverWorker & operator=(const SolverWorker & rhs) = delete;
+
+	//Adds tasks to the queue
+	void Push(const SolverTask tasks[], int numTasks);
+
+	//Takes the most promising task from the queue, if any
+	bool Pop(SolverTask & task);
+
+	//Takes the most promising tasks from the queue, up to a limit
+	int Steal(SolverTask tasks[], int maxTasks);
+
+	//Writes down an expanded position and returns its index
+	int AddStep(const SolverStep & step);
+
+	//Returns an expanded position
+	const SolverStep & GetStep(int index) const;
+
+	//Returns the number of expanded positions
+	int GetNumSteps() const;
+
+	//Keeps a queued position as the best if its estimate is the lowest yet
+	void OfferBest(int score, int step, const Move & move);
+
+	//Getter for m_bestScore
+	int GetBestScore() const;
+
+	//Getter for m_bestStep
+	int GetBestStep() const;
+
+	//Getter for m_bestMove
+	Move GetBestMove() const;
+
+private:
+	PriorityQueue<SolverTask> m_queue;	//Positions waiting to be expanded
+	Array<SolverStep> m_steps;			//Positions expanded
+	std::mutex m_lock;					//Lock of the queue
+	int m_bestScore;					//Lowest estimate of a position queued (see Solver::Evaluate())
+	int m_bestStep;						//Step that position was reached from, -1 if none
+	Move m_bestMove;					//Move that reached it
+};
+
+class ParallelSearch
+{
+public:
+	//5-Arg Overloaded Ctor
+	ParallelSearch(int numThreads, int nodeLimit, size_t memoryLimit, int timeLimit, SharedTranspositionTable & table);
+
+	//Copy Ctor (not allowed, the workers cannot be copied)
+	ParallelSearch(const ParallelSearch & copy) = delete;
+
+	//Default Dtor
+	~ParallelSearch() = default;
+
+	//Assignment Operator (not allowed, the workers cannot be copied)
+	ParallelSearch & operator=(const ParallelSearch & rhs) = delete;
+
+	//Searches for a win from the board on every worker
+	SolveStatus Run(const Board & board);
+
+	//Getter for m_path
+	const Array<Move> & GetPath() const;
+
+	//Getter for m_bestPath
+	const Array<Move> & GetBestPath() const;
+
+	//Getter for m_nodesExpanded
+	int GetNodesExpanded() const;
+
+	//Getter for m_nodesStored
+	int GetNodesStored() const;
+
+private:
+	//Expands positions on one worker until the search ends
+	void Work(int worker);
+
+	//Takes tasks from another worker's queue
+	bool StealWork(int worker, SolverTask & task);
+
+	//Ends the search for a reason, unless it has already ended
+	void Stop(SolveStatus status);
+
+	//Walks back from a move made from a step to collect the moves that reach it
+	void CollectPath(int worker, int step, const Move & move, Array<Move> & path) const;
+
+	int m_numThreads;								//Number of workers
+	int m_nodeLimit;								//Most positions the workers may expand
+	int m_maxNodes;									//Most positions the memory limit allows
+	int m_timeLimit;								//Most milliseconds the workers may run, zero for none
+	std::chrono::steady_clock::time_point m_deadline;	//When the time limit is reached
+	std::unique_ptr<SolverWorker[]> m_workers;		//Queue and steps of each worker
+	SharedTranspositionTable & m_table;				//Canonical hashes of positions reached
+	std::atomic<int> m_nodesExpanded;				//Positions expanded by every worker
+	std::atomic<int> m_nodesStored;					//Positions queued by every worker
+	std::atomic<int> m_pending;						//Tasks queued or being expanded
+	std::atomic<bool> m_stopped;					//Flags that the search has ended
+	std::mutex m_stopLock;							//Lock for ending the search
+	SolveStatus m_status;							//How the search ended
+	int m_winWorker;								//Worker that found the win
+	int m_winStep;									//Its step the winning move was made from
+	Move m_winMove;									//Winning move
+	Array<Move> m_path;								//Moves that reach the win, last first
+	Array<Move> m_bestPath;							//Moves that reach the best position, last first
+};
+
+#endif //PARALLEL_SEARCH_H
@@ -0,0 +1,253 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			persistentStack.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: PersistentStack
+*
+* Purpose:
+*	This class simulates a stack that is never changed once it is
+*	built. Push() and Pop() leave the stack alone and return a new
+*	stack instead, which shares all of the items below its top with
+*	the stack it came from. Copying a PersistentStack copies a single
+*	reference-counted pointer, so keeping many versions of a stack
+*	(for undo or for searching) costs one link per pushed item rather
+*	than a copy of the whole stack. Links are shared through
+*	std::shared_ptr, so versions may be read and released from
+*	different threads.
+*
+* Manager functions:
+*	PersistentStack()
+*		Creates an empty PersistentStack.
+*
+*	PersistentStack(const PersistentStack<T> & copy)
+*		Shares the items of copy.
+*
+*	~PersistentStack()
+*
+*	PersistentStack<T> & operator=(const PersistentStack<T> & rhs)
+*
+* Methods:
+*	PersistentStack<T> Push(const T & data) const
+*		Returns a stack with data on top of this stack's items.
+*
+*	PersistentStack<T> Pop() const
+*		Returns a stack with this stack's items except the top one.
+*
+*	const T & Peek() const
+*		Returns the element on the top of the stack.
+*
+*	const T & operator[](int index) const
+*		Returns the element at the given depth, counting up from the
+*		bottom of the stack (index 0). Takes time proportional to the
+*		distance from the top.
+*
+*	int Size() const
+*		Returns the number of items on the stack.
+*
+*	bool isEmpty() const
+*		Returns true if the stack is empty.
+**********************************************************************/
+#ifndef PERSISTENT_STACK_H
+#define PERSISTENT_STACK_H
+
+#include "exception.h"
+#include "bounds.h"
+
+#include <memory>
+
+template <typename T, typename Bounds = DefaultBounds>
+class PersistentStack
+{
+public:
+	//Default Ctor
+	PersistentStack();
+
+	//Copy Ctor (shares the items)
+	PersistentStack(const PersistentStack<T, Bounds> & copy) = default;
+
+	//Default Dtor
+	~PersistentStack() = default;
+
+	//Assignment Operator (shares the items)
+	PersistentStack<T, Bounds> & operator=(const PersistentStack<T, Bounds> & rhs) = default;
+
+	//Returns a stack with data pushed on top
+	PersistentStack<T, Bounds> Push(const T & data) const;
+
+	//Returns a stack with the top item removed
+	PersistentStack<T, Bounds> Pop() const;
+
+	//Returns the element on the top of the stack
+	const T & Peek() const;
+
+	//Returns the element at a depth counted from the bottom of the stack
+	const T & operator[](int index) const;
+
+	//Returns the number of items on the stack
+	int Size() const;
+
+	//Returns true if the stack is empty
+	bool isEmpty() const;
+
+private:
+	//One item of the stack and the (shared) items below it
+	struct Link
+	{
+		T m_data;								//Item held in this link
+		std::shared_ptr<const Link> m_below;	//Link of the item below, nullptr at the bottom
+	};
+
+	//2-Arg Overloaded Ctor
+	PersistentStack(std::shared_ptr<const Link> top, int size);
+
+	std::shared_ptr<const Link> m_top;	//Link of the top item, nullptr if empty
+	int m_size;							//Number of items on the stack
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty PersistentStack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template<typename T, typename Bounds>
+PersistentStack<T, Bounds>::PersistentStack() : m_size(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a PersistentStack from a top link and its size.
+*
+* Precondition:
+*	The link of the top item (nullptr if empty) and the number of
+*	items.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+template<typename T, typename Bounds>
+PersistentStack<T, Bounds>::PersistentStack(std::shared_ptr<const Link> top, int size) : m_top(std::move(top)), m_size(size)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To return a stack with an item added on top of this stack's items.
+*	This stack is not changed, and the new stack shares its items.
+*
+* Precondition:
+*	A template type that represents the data item to put on the stack.
+*
+* Postcondition:
+*	The new stack is returned.
+**********************************************************************/
+template<typename T, typename Bounds>
+PersistentStack<T, Bounds> PersistentStack<T, Bounds>::Push(const T & data) const
+{
+	return PersistentStack<T, Bounds>(std::make_shared<const Link>(Link{ data, m_top }), m_size + 1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a stack with this stack's items except the top one. This
+*	stack is not changed, and nothing is copied or allocated.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The new stack is returned, if this stack is not empty.
+**********************************************************************/
+template<typename T, typename Bounds>
+PersistentStack<T, Bounds> PersistentStack<T, Bounds>::Pop() const
+{
+	//Check if stack is already empty
+	Bounds::Check(!isEmpty(), "ERROR: Stack underflow detected.");
+
+	return PersistentStack<T, Bounds>(m_top->m_below, m_size - 1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the item on the top of the stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The item on the top of the stack is returned, if the stack is not
+*	empty.
+**********************************************************************/
+template<typename T, typename Bounds>
+const T & PersistentStack<T, Bounds>::Peek() const
+{
+	//Check if stack is already empty
+	Bounds::Check(!isEmpty(), "ERROR: Cannot access top of empty stack.");
+
+	return m_top->m_data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an item at a given depth of the stack, counting up from
+*	the bottom of the stack. The links are walked down from the top.
+*
+* Precondition:
+*	An integer from 0 (bottom of stack) to Size() - 1 (top of stack).
+*
+* Postcondition:
+*	The item at the given depth is returned, if it is on the stack.
+**********************************************************************/
+template<typename T, typename Bounds>
+const T & PersistentStack<T, Bounds>::operator[](int index) const
+{
+	//Check if index is below bottom or above top of stack
+	Bounds::Check(index >= 0 && index < m_size, "ERROR: Stack index out of range.");
+
+	const Link * travel = m_top.get();	//Traveling pointer to walk down the stack
+
+	//Walk down from the top to the desired depth
+	for (int i = m_size - 1; i > index; i--)
+		travel = travel->m_below.get();
+
+	return travel->m_data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of items on the stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of items on the stack is returned.
+**********************************************************************/
+template<typename T, typename Bounds>
+int PersistentStack<T, Bounds>::Size() const
+{
+	return m_size;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not the stack is empty.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A bool is returned signaling whether or not the stack is empty.
+**********************************************************************/
+template<typename T, typename Bounds>
+bool PersistentStack<T, Bounds>::isEmpty() const
+{
+	return (m_size == 0);
+}
+
+#endif //PERSISTENT_STACK_H
@@ -0,0 +1,348 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			priorityQueue.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: PriorityQueue
+*
+* Purpose:
+*	This class simulates a priority queue, and uses an Array object as
+*	the underlying data structure, kept as a binary heap. The item
+*	that compares lowest (by operator<) is always at the front, so
+*	Push() and Pop() take time proportional to the log of the number
+*	of items. Items are moved within the Array rather than linked, so
+*	a queue of small trivially copyable items (such as the Solver's
+*	frontier entries) never allocates except when it grows.
+*
+* Manager functions:
+*	PriorityQueue()
+*		Creates an empty PriorityQueue.
+*
+*	PriorityQueue(const PriorityQueue<T> & copy)
+*
+*	~PriorityQueue()
+*
+*	PriorityQueue<T> & operator=(const PriorityQueue<T> & rhs)
+*
+* Methods:
+*	void Push(const T & data)
+*		Adds its parameter to the queue.
+*
+*	T Pop()
+*		Removes and returns the lowest item of the queue.
+*
+*	const T & Peek() const
+*		Returns the lowest item of the queue but does not remove it.
+*
+*	int Size() const
+*		Returns the number of items currently in the queue.
+*
+*	bool isEmpty() const
+*		Returns true if the queue is empty.
+*
+*	void Clear()
+*		Removes every item, keeping the room for them.
+*
+*	void Reserve(int capacity)
+*		Makes room for at least the given number of items.
+*
+*	const T & operator[](int index) const
+*		Returns an item by its place in the heap, which is not the
+*		order the items come out in.
+*
+*	void Assign(const Array<T> & items)
+*		Replaces the items of the queue with the items of an Array, in
+*		time proportional to the number of items.
+**********************************************************************/
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include "array.h"
+
+template <typename T>
+class PriorityQueue
+{
+public:
+	//Default Ctor
+	PriorityQueue() = default;
+
+	//Copy Ctor
+	PriorityQueue(const PriorityQueue<T> & copy) = default;
+
+	//Default Dtor
+	~PriorityQueue() = default;
+
+	//Assignment Operator
+	PriorityQueue<T> & operator=(const PriorityQueue<T> & rhs) = default;
+
+	//Adds its parameter to the queue
+	void Push(const T & data);
+
+	//Removes and returns the lowest item of the queue
+	T Pop();
+
+	//Returns the lowest item of the queue but does not remove it
+	const T & Peek() const;
+
+	//Returns the number of items currently in the queue
+	int Size() const;
+
+	//Returns true if the queue is empty
+	bool isEmpty() const;
+
+	//Removes every item, keeping the room for them
+	void Clear();
+
+	//Makes room for at least the given number of items
+	void Reserve(int capacity);
+
+	//Returns an item by its place in the heap
+	const T & operator[](int index) const;
+
+	//Replaces the items of the queue with the items of an Array
+	template <typename Bounds>
+	void Assign(const Array<T, Bounds> & items);
+
+private:
+	Array<T, UncheckedBounds> m_heap;	//Binary heap: each item is no higher than its children (the queue checks its own bounds)
+};
+
+/**********************************************************************
+* Purpose:
+*	To add an item to the queue. The item is placed at the end of the
+*	heap and moved up past every parent that is higher than it.
+*
+* Precondition:
+*	A template type of the data to add to the queue.
+*
+* Postcondition:
+*	The item is in the queue.
+**********************************************************************/
+template <typename T>
+void PriorityQueue<T>::Push(const T & data)
+{
+	int child = m_heap.getLength();	//Index the item is moving up from
+
+	m_heap.push_back(data);
+
+	while (child > 0)
+	{
+		int parent = (child - 1) / 2;	//Index of the parent of child
+
+		if (!(data < m_heap[parent]))
+			break;
+
+		m_heap[child] = m_heap[parent];
+		child = parent;
+	}
+
+	m_heap[child] = data;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove and return the lowest item of the queue. The last item
+*	of the heap takes the place of the first one and is moved down past
+*	every child that is lower than it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The lowest item is removed and returned, only if the queue is not
+*	empty; else, an exception is thrown.
+**********************************************************************/
+template <typename T>
+T PriorityQueue<T>::Pop()
+{
+	if (isEmpty())
+		throw Exception("ERROR: Cannot remove an item from an empty priority queue.");
+
+	T lowest = m_heap[0];					//Item being removed
+	int size = m_heap.getLength() - 1;		//Number of items left
+	T last = m_heap[size];					//Item moving down from the top
+	int parent = 0;							//Index the last item is moving down from
+
+	m_heap.resize(size);
+
+	if (size > 0)
+	{
+		while (2 * parent + 1 < size)
+		{
+			int child = 2 * parent + 1;	//Index of the lower child of parent
+
+			if (child + 1 < size && m_heap[child + 1] < m_heap[child])
+				child++;
+
+			if (!(m_heap[child] < last))
+				break;
+
+			m_heap[parent] = m_heap[child];
+			parent = child;
+		}
+
+		m_heap[parent] = last;
+	}
+
+	return lowest;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the lowest item of the queue but not remove it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The lowest item is returned, only if the queue is not empty; else,
+*	an exception is thrown.
+**********************************************************************/
+template <typename T>
+const T & PriorityQueue<T>::Peek() const
+{
+	if (isEmpty())
+		throw Exception("ERROR: Cannot peek at an empty priority queue.");
+
+	return m_heap[0];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of items currently in the queue.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of items in the queue is returned.
+**********************************************************************/
+template <typename T>
+int PriorityQueue<T>::Size() const
+{
+	return m_heap.getLength();
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not the queue is empty.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if the queue is empty.
+**********************************************************************/
+template <typename T>
+bool PriorityQueue<T>::isEmpty() const
+{
+	return (m_heap.getLength() == 0);
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove every item from the queue. The underlying Array keeps its
+*	room, so refilling the queue does not reallocate.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The queue is empty.
+**********************************************************************/
+template <typename T>
+void PriorityQueue<T>::Clear()
+{
+	m_heap.resize(0);
+}
+
+/**********************************************************************
+* Purpose:
+*	To make room for a number of items up front, so pushing that many
+*	does not reallocate.
+*
+* Precondition:
+*	A non-negative number of items.
+*
+* Postcondition:
+*	The queue has room for at least that many items.
+**********************************************************************/
+template <typename T>
+void PriorityQueue<T>::Reserve(int capacity)
+{
+	m_heap.reserve(capacity);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an item by its place in the heap, such as to look at
+*	every item without taking them out. The first item is the lowest;
+*	the rest are in no particular order.
+*
+* Precondition:
+*	An index from 0 to Size() - 1.
+*
+* Postcondition:
+*	The item is returned, only if the index is in range; else, an
+*	exception is thrown.
+**********************************************************************/
+template <typename T>
+const T & PriorityQueue<T>::operator[](int index) const
+{
+	if (index < 0 || index >= m_heap.getLength())
+		throw Exception("ERROR: Priority queue index out of bounds.");
+
+	return m_heap[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To replace the items of the queue with the items of an Array, in
+*	any order. The heap is built from the bottom up, moving each parent
+*	down past every child lower than it, which takes time proportional
+*	to the number of items rather than pushing them one at a time.
+*
+* Precondition:
+*	An existing Array object passed by const ref.
+*
+* Postcondition:
+*	The queue holds the items of the Array, keeping its room if the
+*	Array fits in it.
+**********************************************************************/
+template <typename T>
+template <typename Bounds>
+void PriorityQueue<T>::Assign(const Array<T, Bounds> & items)
+{
+	int size = items.getLength();	//Number of items
+
+	m_heap.resize(0);
+	m_heap.reserve(size);
+
+	for (int i = 0; i < size; i++)
+		m_heap.push_back(items[i]);
+
+	for (int start = size / 2 - 1; start >= 0; start--)
+	{
+		T moving = m_heap[start];	//Item moving down
+		int parent = start;			//Index it is moving down from
+
+		while (2 * parent + 1 < size)
+		{
+			int child = 2 * parent + 1;	//Index of the lower child of parent
+
+			if (child + 1 < size && m_heap[child + 1] < m_heap[child])
+				child++;
+
+			if (!(m_heap[child] < moving))
+				break;
+
+			m_heap[parent] = m_heap[child];
+			parent = child;
+		}
+
+		m_heap[parent] = moving;
+	}
+}
+
+#endif //PRIORITY_QUEUE_H
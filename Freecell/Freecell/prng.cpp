@@ -0,0 +1,92 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			prng.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "prng.h"
+
+#include <chrono>
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Prng seeded with zero.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The generator state is initialized from a seed of zero.
+**********************************************************************/
+Prng::Prng()
+{
+	Seed(0);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a Prng seeded with the value of the
+*	parameter.
+*
+* Precondition:
+*	A 64-bit seed.
+*
+* Postcondition:
+*	The generator state is initialized from the seed.
+**********************************************************************/
+Prng::Prng(unsigned long long seed)
+{
+	Seed(seed);
+}
+
+/**********************************************************************
+* Purpose:
+*	To reset the generator state from a 64-bit seed. The seed is
+*	expanded with splitmix64 so that similar seeds (such as 1, 2, 3)
+*	still produce unrelated sequences.
+*
+* Precondition:
+*	A 64-bit seed.
+*
+* Postcondition:
+*	The generator state is re-initialized from the seed.
+**********************************************************************/
+void Prng::Seed(unsigned long long seed)
+{
+	for (int i = 0; i < PRNG_STATE_WORDS; i++)
+	{
+		seed += 0x9E3779B97F4A7C15ULL;
+
+		m_state[i] = Mix(seed);	//splitmix64 output for this word
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the calling thread's own generator. The generator is
+*	seeded from the clock and its own address the first time a thread
+*	asks for it, so threads started at the same moment still differ.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A reference to the calling thread's generator is returned.
+**********************************************************************/
+Prng & Prng::ThreadLocal()
+{
+	thread_local Prng generator;	//One generator per thread
+	thread_local bool seeded = false;	//Flags whether generator has been seeded on this thread
+
+	if (seeded == false)
+	{
+		unsigned long long clock = static_cast<unsigned long long>(
+			std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+		generator.Seed(clock ^ reinterpret_cast<unsigned long long>(&generator));
+		seeded = true;
+	}
+
+	return generator;
+}
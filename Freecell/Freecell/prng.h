@@ -0,0 +1,154 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			prng.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Prng
+*
+* Purpose:
+*	This class is a small, fast 64-bit pseudo-random number generator
+*	(xoshiro256**). Each instance owns its own state, so a generator
+*	can be seeded explicitly to reproduce a sequence, and each thread
+*	can use its own generator without sharing any global state.
+*
+* Manager functions:
+*	Prng()
+*		Creates a Prng seeded with zero.
+*
+*	Prng(unsigned long long seed)
+*		Creates a Prng seeded with the value of the parameter.
+*
+*	Prng(const Prng & copy)
+*
+*	~Prng()
+*
+*	Prng & operator=(const Prng & rhs)
+*
+* Methods:
+*	void Seed(unsigned long long seed)
+*		Resets the state of the generator from a 64-bit seed.
+*
+*	unsigned long long Next()
+*		Returns the next 64-bit pseudo-random value.
+*
+*	unsigned int Bounded(unsigned int range)
+*		Returns a pseudo-random value from 0 up to (not including)
+*		range.
+*
+*	static Prng & ThreadLocal()
+*		Returns the calling thread's own generator, seeded once from
+*		the clock the first time the thread asks for it.
+*
+*	static unsigned long long Mix(unsigned long long value)
+*		Scrambles a 64-bit value (the splitmix64 finalizer), so that
+*		nearby inputs give unrelated outputs. Used to derive hash keys
+*		without storing a table of random numbers.
+**********************************************************************/
+#ifndef PRNG_H
+#define PRNG_H
+
+const int PRNG_STATE_WORDS = 4;	//Number of 64-bit words of generator state
+
+class Prng
+{
+public:
+	//Default Ctor
+	Prng();
+
+	//1-Arg Overloaded Ctor
+	Prng(unsigned long long seed);
+
+	//Copy Ctor
+	Prng(const Prng & copy) = default;
+
+	//Default Dtor
+	~Prng() = default;
+
+	//Assignment Operator
+	Prng & operator=(const Prng & rhs) = default;
+
+	//Resets the state of the generator from a seed
+	void Seed(unsigned long long seed);
+
+	//Returns the next 64-bit pseudo-random value
+	unsigned long long Next();
+
+	//Returns a pseudo-random value in [0, range)
+	unsigned int Bounded(unsigned int range);
+
+	//Returns the calling thread's own generator
+	static Prng & ThreadLocal();
+
+	//Scrambles a 64-bit value (splitmix64 finalizer)
+	static unsigned long long Mix(unsigned long long value);
+
+private:
+	unsigned long long m_state[PRNG_STATE_WORDS];	//Generator state, never all zero
+};
+
+/**********************************************************************
+* Purpose:
+*	To advance the generator and return the next 64-bit value.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The state is advanced one step and the next value is returned.
+**********************************************************************/
+inline unsigned long long Prng::Next()
+{
+	unsigned long long result = m_state[1] * 5;
+	result = ((result << 7) | (result >> 57)) * 9;
+
+	unsigned long long shifted = m_state[1] << 17;
+
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= shifted;
+	m_state[3] = (m_state[3] << 45) | (m_state[3] >> 19);
+
+	return result;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return a pseudo-random value from 0 up to (not including) the
+*	value of the parameter, without using a division.
+*
+* Precondition:
+*	An unsigned integer range greater than zero.
+*
+* Postcondition:
+*	A value in [0, range) is returned.
+**********************************************************************/
+inline unsigned int Prng::Bounded(unsigned int range)
+{
+	//Scale the high 32 bits into the range (multiply-shift instead of modulo)
+	return static_cast<unsigned int>(((Next() >> 32) * range) >> 32);
+}
+
+/**********************************************************************
+* Purpose:
+*	To scramble a 64-bit value with the splitmix64 finalizer. Every
+*	input bit affects every output bit, and different inputs always
+*	give different outputs.
+*
+* Precondition:
+*	A 64-bit value.
+*
+* Postcondition:
+*	The scrambled value is returned.
+**********************************************************************/
+inline unsigned long long Prng::Mix(unsigned long long value)
+{
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+	return value ^ (value >> 31);
+}
+
+#endif //PRNG_H
@@ -0,0 +1,1027 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			solver.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "solver.h"
+#include "parallelSearch.h"
+
+#include <chrono>
+#include <climits>
+#include <thread>
+
+/**********************************************************************
+* Purpose:
+*	To construct a placeholder SolverNode, for filling arrays.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to an empty key with no parent.
+**********************************************************************/
+SolverNode::SolverNode() : m_hash(0), m_parent(-1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a SolverNode for a position reached by a move.
+*
+* Precondition:
+*	The key of the position, its canonical hash, the index of the
+*	position it was reached from, and the move that reached it.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+SolverNode::SolverNode(const BoardKey & key, unsigned long long hash, int parent, const Move & move) :
+	m_key(key), m_hash(hash), m_parent(parent), m_move(move)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To return the key of the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The key is returned.
+**********************************************************************/
+const BoardKey & SolverNode::GetKey() const
+{
+	return m_key;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the canonical hash of the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The hash is returned.
+**********************************************************************/
+unsigned long long SolverNode::GetHash() const
+{
+	return m_hash;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the index of the position this one was reached from.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index is returned, or -1 for the starting position.
+**********************************************************************/
+int SolverNode::GetParent() const
+{
+	return m_parent;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the move that reached the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The move is returned.
+**********************************************************************/
+Move SolverNode::GetMove() const
+{
+	return m_move;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a placeholder SolverEntry, for filling arrays.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to zero.
+**********************************************************************/
+SolverEntry::SolverEntry() : m_priority(0), m_node(0), m_depth(0)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a SolverEntry for a stored position.
+*
+* Precondition:
+*	The priority of the position, the index of its SolverNode, and the
+*	number of moves that reached it.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters.
+**********************************************************************/
+SolverEntry::SolverEntry(int priority, int node, int depth) : m_priority(priority), m_node(node), m_depth(depth)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To overload the < operator in order to order the Solver's queue.
+*
+* Precondition:
+*	An existing SolverEntry object passed by const ref.
+*
+* Postcondition:
+*	True is returned if this entry has the lower priority, or the same
+*	priority and the later node.
+**********************************************************************/
+bool SolverEntry::operator<(const SolverEntry & rhs) const
+{
+	return (m_priority < rhs.m_priority || (m_priority == rhs.m_priority && m_node > rhs.m_node));
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the priority of the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The estimated moves to a win through the position are returned.
+**********************************************************************/
+int SolverEntry::GetPriority() const
+{
+	return m_priority;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the index of the SolverNode of the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The index is returned.
+**********************************************************************/
+int SolverEntry::GetNode() const
+{
+	return m_node;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of moves that reached the position.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of moves is returned.
+**********************************************************************/
+int SolverEntry::GetDepth() const
+{
+	return m_depth;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct a Solver with the default limits.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+Solver::Solver() : m_bestNode(-1), m_bestScore(INT_MAX), m_canContinue(false), m_rerooted(false), m_maxNodes(0),
+	m_nodesExpanded(0), m_nodesStored(0), m_nodeLimit(SOLVER_DEFAULT_NODE_LIMIT),
+	m_memoryLimit(SOLVER_DEFAULT_MEMORY_LIMIT), m_timeLimit(0), m_numThreads(1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a Solver with given limits.
+*
+* Precondition:
+*	The most positions a search may expand and the most bytes it may
+*	use.
+*
+* Postcondition:
+*	Data members are initialized to the values of the parameters, and
+*	a search runs on one thread with no time limit.
+**********************************************************************/
+Solver::Solver(int nodeLimit, size_t memoryLimit) : m_bestNode(-1), m_bestScore(INT_MAX), m_canContinue(false),
+	m_rerooted(false), m_maxNodes(0), m_nodesExpanded(0), m_nodesStored(0), m_nodeLimit(nodeLimit),
+	m_memoryLimit(memoryLimit), m_timeLimit(0), m_numThreads(1)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct a Solver as a copy of another. The table of the
+*	threaded search is not copied; the copy makes its own when it first
+*	needs one, so two Solvers never share it.
+*
+* Precondition:
+*	An existing Solver object passed by const ref.
+*
+* Postcondition:
+*	Data members are copied, except the table of the threaded search.
+**********************************************************************/
+Solver::Solver(const Solver & copy) : m_nodes(copy.m_nodes), m_frontier(copy.m_frontier), m_table(copy.m_table),
+	m_solution(copy.m_solution), m_bestLine(copy.m_bestLine), m_start(copy.m_start), m_bestNode(copy.m_bestNode),
+	m_bestScore(copy.m_bestScore), m_canContinue(copy.m_canContinue), m_rerooted(copy.m_rerooted),
+	m_maxNodes(copy.m_maxNodes), m_nodesExpanded(copy.m_nodesExpanded), m_nodesStored(copy.m_nodesStored),
+	m_nodeLimit(copy.m_nodeLimit), m_memoryLimit(copy.m_memoryLimit), m_timeLimit(copy.m_timeLimit),
+	m_numThreads(copy.m_numThreads)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To assign one Solver to another. The table of the threaded search
+*	is dropped, as for a copy.
+*
+* Precondition:
+*	An existing Solver object passed by const ref.
+*
+* Postcondition:
+*	Data members are copied, except the table of the threaded search,
+*	and *this is returned.
+**********************************************************************/
+Solver & Solver::operator=(const Solver & rhs)
+{
+	if (this != &rhs)
+	{
+		m_nodes = rhs.m_nodes;
+		m_frontier = rhs.m_frontier;
+		m_table = rhs.m_table;
+		m_sharedTable.reset();
+		m_solution = rhs.m_solution;
+		m_bestLine = rhs.m_bestLine;
+		m_start = rhs.m_start;
+		m_bestNode = rhs.m_bestNode;
+		m_bestScore = rhs.m_bestScore;
+		m_canContinue = rhs.m_canContinue;
+		m_rerooted = rhs.m_rerooted;
+		m_maxNodes = rhs.m_maxNodes;
+		m_nodesExpanded = rhs.m_nodesExpanded;
+		m_nodesStored = rhs.m_nodesStored;
+		m_nodeLimit = rhs.m_nodeLimit;
+		m_memoryLimit = rhs.m_memoryLimit;
+		m_timeLimit = rhs.m_timeLimit;
+		m_numThreads = rhs.m_numThreads;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To search for a win from a board, on this thread or on several.
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref.
+*
+* Postcondition:
+*	SOLVE_SOLVED is returned and GetSolution() holds the winning moves
+*	if a win was found; else, the solution is empty and the reason the
+*	search ended is returned. Either way, GetBestLine() holds the moves
+*	to the most promising position reached.
+**********************************************************************/
+SolveStatus Solver::Solve(const Board & board)
+{
+	SolveStatus status;	//How the search ended
+
+	m_solution.resize(0);
+	m_bestLine.resize(0);
+	m_start.Encode(board);
+	m_canContinue = false;
+
+	if (m_numThreads == 1)
+	{
+		status = SolveOneThread(board, std::chrono::steady_clock::now() + std::chrono::milliseconds(m_timeLimit));
+		EndOneThread(board, status);
+	}
+	else
+		status = SolveThreads(board);
+
+	return status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To continue the last search from where its time limit stopped it,
+*	with the positions it stored and queued, for another stretch of
+*	the time limit. The node limit counts every position expanded
+*	since the search began (or was rerooted). A search that cannot be
+*	continued (it ended another way, or ran on several threads) is run
+*	again from the board it began from, and so is a rerooted search
+*	that runs out of positions, since the positions Reroot() dropped
+*	may have been the way to a win; that search gets what is left of
+*	the same stretch of the time limit.
+*
+* Precondition:
+*	Solve() has been called.
+*
+* Postcondition:
+*	The search has ended again, as for Solve().
+**********************************************************************/
+SolveStatus Solver::Continue()
+{
+	Board start;			//Board the search began from
+	SolveStatus status;		//How the search ended
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()
+		+ std::chrono::milliseconds(m_timeLimit);	//When the time limit is reached
+
+	if (m_start == BoardKey())
+		throw Exception("ERROR: There is no search to continue.");
+
+	m_start.Decode(start);
+
+	if (!m_canContinue)
+		return Solve(start);
+
+	m_solution.resize(0);
+	m_bestLine.resize(0);
+	m_canContinue = false;
+
+	status = SearchOneThread(start, deadline);
+
+	if (status == SOLVE_UNSOLVABLE && m_rerooted)
+		status = SolveOneThread(start, deadline);
+
+	EndOneThread(start, status);
+
+	return status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To move the last one-thread search onto a position it stored, so it
+*	can be continued from a board the player has moved on to. The
+*	position becomes the start, the positions stored below it are
+*	kept (renumbered, in the same order), and every other position is
+*	dropped from the store, the queue, and the table, so they can be
+*	reached again from the new start. The positions left in the queue
+*	keep their order, since their priorities all drop by the moves it
+*	took to reach the new start.
+*
+*	Only the positions that were waiting in the queue and the new
+*	start are looked at for the most promising position. A position
+*	below the new start whose moves led to a dropped position does not
+*	lead there again, so the search is flagged as rerooted and is not
+*	trusted to show that a game cannot be won (see Continue()).
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref.
+*
+* Postcondition:
+*	True is returned and the search can be continued from the board if
+*	the last search ran on one thread and stored the board (after the
+*	cards that are safe to go home are sent there); else, false is
+*	returned and nothing is changed.
+**********************************************************************/
+bool Solver::Reroot(const Board & board)
+{
+	Board current = board;			//Board with the safe cards sent home
+	BoardKey key;					//Its key
+	int numNodes = m_nodes.getLength();	//Positions stored
+	int root = -1;					//Index of the new start
+	int rootDepth = 0;				//Moves that reached it from the old start
+
+	if (m_numThreads != 1)
+		return false;
+
+	current.AutoPlay();
+	key.Encode(current);
+
+	for (int i = 0; i < numNodes && root < 0; i++)
+	{
+		if (m_nodes[i].GetKey() == key)
+			root = i;
+	}
+
+	if (root < 0)
+		return false;
+
+	for (int i = root; m_nodes[i].GetParent() >= 0; i = m_nodes[i].GetParent())
+		rootDepth++;
+
+	//***Keep the positions below the new start (a parent is always stored before its children)
+
+	Array<int> renumber;	//New index of each position from the new start on, -1 if dropped
+	int numKept = 0;		//Positions kept
+
+	renumber.reserve(numNodes - root);
+
+	for (int i = root; i < numNodes; i++)
+	{
+		int parent = m_nodes[i].GetParent();	//Old index of the position it was reached from
+
+		if (i == root)
+		{
+			renumber.push_back(numKept);
+			m_nodes[numKept++] = SolverNode(key, current.GetCanonicalHash(), -1, Move());
+		}
+		else if (parent >= root && renumber[parent - root] >= 0)
+		{
+			renumber.push_back(numKept);
+			m_nodes[numKept++] = SolverNode(m_nodes[i].GetKey(), m_nodes[i].GetHash(), renumber[parent - root],
+				m_nodes[i].GetMove());
+		}
+		else
+			renumber.push_back(-1);
+	}
+
+	m_nodes.resize(numKept);
+
+	//***Keep the queued positions below the new start
+
+	Array<SolverEntry> kept;	//Queued positions kept, renumbered
+
+	kept.reserve(m_frontier.Size());
+	m_bestNode = 0;
+	m_bestScore = Evaluate(current);
+
+	for (int i = 0; i < m_frontier.Size(); i++)
+	{
+		const SolverEntry & entry = m_frontier[i];	//Queued position
+
+		if (entry.GetNode() >= root && renumber[entry.GetNode() - root] >= 0)
+		{
+			int node = renumber[entry.GetNode() - root];	//Its new index
+
+			if (entry.GetPriority() - entry.GetDepth() < m_bestScore)
+			{
+				m_bestNode = node;
+				m_bestScore = entry.GetPriority() - entry.GetDepth();
+			}
+
+			kept.push_back(SolverEntry(entry.GetPriority() - rootDepth, node, entry.GetDepth() - rootDepth));
+		}
+	}
+
+	m_frontier.Assign(kept);
+
+	//***Keep the table to the positions kept
+
+	m_table.Clear();
+
+	for (int i = 0; i < numKept; i++)
+		m_table.Insert(m_nodes[i].GetHash());
+
+	m_start.Encode(board);
+	m_solution.resize(0);
+	m_bestLine.resize(0);
+	m_nodesExpanded = 0;
+	m_nodesStored = numKept;
+	m_canContinue = true;
+	m_rerooted = true;
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To search for a win from a board on this thread. The cards that
+*	are safe to go home go first; then the most promising position is
+*	taken from the queue, rebuilt from its key, and every legal move
+*	from it is made and taken back in turn (with Board::UndoMove()),
+*	storing each position not reached before. A quarter of the memory
+*	limit goes to the table and the rest to the positions and the
+*	queue.
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref,
+*	and when the time limit (if any) is reached.
+*
+* Postcondition:
+*	SOLVE_SOLVED is returned and the solution holds the winning moves
+*	if a win was found; else, the reason the search ended is
+*	returned.
+**********************************************************************/
+SolveStatus Solver::SolveOneThread(const Board & board, std::chrono::steady_clock::time_point deadline)
+{
+	Board current = board;					//Starting position
+	size_t tableSlots = m_memoryLimit / 4 / sizeof(unsigned long long);				//Slots the table may have
+	size_t maxNodes = m_memoryLimit / 4 * 3 / (sizeof(SolverNode) + sizeof(SolverEntry));	//Positions the rest allows
+
+	m_nodes.resize(0);
+	m_frontier.Clear();
+	m_table.Clear();
+	m_nodesExpanded = 0;
+	m_bestNode = -1;
+	m_bestScore = INT_MAX;
+	m_rerooted = false;
+
+	m_table.SetMaxCapacity((tableSlots < static_cast<size_t>(TT_MAX_CAPACITY)) ? static_cast<int>(tableSlots) : TT_MAX_CAPACITY);
+	m_maxNodes = (maxNodes < static_cast<size_t>(INT_MAX)) ? static_cast<int>(maxNodes) : INT_MAX;
+
+	current.AutoPlay();
+
+	if (current.WonGame())
+	{
+		BuildLine(board, Array<Move>(), m_solution);
+		return SOLVE_SOLVED;
+	}
+
+	m_table.Insert(current.GetCanonicalHash());
+
+	if (!AddNode(current, -1, Move(), 0))
+		return SOLVE_MEMORY_LIMIT;
+
+	return SearchOneThread(board, deadline);
+}
+
+/**********************************************************************
+* Purpose:
+*	To expand the most promising queued position, one after another,
+*	until a win is found or the search ends. The clock is only looked
+*	at every SOLVER_CLOCK_INTERVAL positions, and always before a
+*	position is taken from the queue, so a search stopped by its time
+*	limit can carry on later exactly where it stopped.
+*
+* Precondition:
+*	The board the search began from, passed by const ref, with its
+*	starting position stored and queued, and when the time limit (if
+*	any) is reached.
+*
+* Postcondition:
+*	SOLVE_SOLVED is returned and the solution holds the winning moves
+*	if a win was found; else, the reason the search ended is
+*	returned.
+**********************************************************************/
+SolveStatus Solver::SearchOneThread(const Board & start, std::chrono::steady_clock::time_point deadline)
+{
+	Board current;							//Position being expanded
+	Move moves[MAX_LEGAL_MOVES];			//Legal moves from the current position
+	Move autoMoves[NUM_CARDS_DECK];			//Cards sent home after a move
+	int sinceClock = 0;						//Positions expanded since the clock was looked at
+
+	while (!m_frontier.isEmpty())
+	{
+		if (m_nodesExpanded >= m_nodeLimit)
+			return SOLVE_NODE_LIMIT;
+
+		if (m_timeLimit > 0 && ++sinceClock >= SOLVER_CLOCK_INTERVAL)
+		{
+			sinceClock = 0;
+
+			if (std::chrono::steady_clock::now() >= deadline)
+				return SOLVE_TIME_LIMIT;
+		}
+
+		SolverEntry entry = m_frontier.Pop();	//Most promising position
+		int numMoves = 0;						//Number of legal moves from it
+
+		m_nodes[entry.GetNode()].GetKey().Decode(current);
+		m_nodesExpanded++;
+
+		numMoves = current.GenerateMoves(moves, MAX_LEGAL_MOVES, MOVE_FILTER_ALL | MOVE_FILTER_DISTINCT);
+
+		for (int i = 0; i < numMoves; i++)
+		{
+			current.MakeMove(moves[i]);
+
+			int numAutoMoves = current.AutoPlay(autoMoves, NUM_CARDS_DECK);	//Cards sent home after the move
+
+			if (current.WonGame())
+			{
+				Array<Move> path;	//Moves that reach the win, last first
+
+				path.push_back(moves[i]);
+				CollectPath(entry.GetNode(), path);
+				BuildLine(start, path, m_solution);
+
+				return SOLVE_SOLVED;
+			}
+
+			if (m_table.Insert(current.GetCanonicalHash()))
+			{
+				if (!AddNode(current, entry.GetNode(), moves[i], entry.GetDepth() + 1))
+					return SOLVE_MEMORY_LIMIT;
+			}
+			else if (m_table.isFull())
+				return SOLVE_MEMORY_LIMIT;
+
+			//Take the move back for the next one
+			while (numAutoMoves > 0)
+				current.UndoMove(autoMoves[--numAutoMoves]);
+
+			current.UndoMove(moves[i]);
+		}
+	}
+
+	return SOLVE_UNSOLVABLE;
+}
+
+/**********************************************************************
+* Purpose:
+*	To record how a search on this thread ended and build its best
+*	line: the solution if it won, else the moves to the stored position
+*	with the lowest estimate.
+*
+* Precondition:
+*	The board the search began from, passed by const ref, and how the
+*	search ended.
+*
+* Postcondition:
+*	The node count and best line are up to date, and the search is
+*	flagged as one that can be continued if its time limit stopped it.
+**********************************************************************/
+void Solver::EndOneThread(const Board & start, SolveStatus status)
+{
+	m_nodesStored = m_nodes.getLength();
+	m_canContinue = (status == SOLVE_TIME_LIMIT);
+
+	if (status == SOLVE_SOLVED)
+		m_bestLine = m_solution;
+	else if (m_bestNode >= 0)
+	{
+		Array<Move> path;	//Moves that reach the best position, last first
+
+		CollectPath(m_bestNode, path);
+		BuildLine(start, path, m_bestLine);
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To search for a win from a board on several threads with a
+*	ParallelSearch, which gets the same share of the limits. The
+*	shared table is made on the first such search and kept for the
+*	next ones, so it is only allocated again when the memory limit
+*	changes.
+*
+* Precondition:
+*	An existing Board object holding all 52 cards passed by const ref.
+*
+* Postcondition:
+*	SOLVE_SOLVED is returned and the solution holds the winning moves
+*	if a win was found; else, the reason the search ended is returned.
+**********************************************************************/
+SolveStatus Solver::SolveThreads(const Board & board)
+{
+	int numThreads = m_numThreads;	//Number of workers
+
+	if (numThreads <= 0)
+		numThreads = static_cast<int>(std::thread::hardware_concurrency());
+
+	if (numThreads <= 0)
+		numThreads = 1;
+
+	if (!m_sharedTable)
+		m_sharedTable.reset(new SharedTranspositionTable(m_memoryLimit / 4));
+
+	//The positions of an earlier one-thread search are not this search's, so Reroot() must not find them
+	m_nodes.resize(0);
+
+	ParallelSearch search(numThreads, m_nodeLimit, m_memoryLimit, m_timeLimit, *m_sharedTable);
+	SolveStatus status = search.Run(board);	//How the search ended
+
+	m_nodesExpanded = search.GetNodesExpanded();
+	m_nodesStored = search.GetNodesStored();
+
+	if (status == SOLVE_SOLVED)
+	{
+		BuildLine(board, search.GetPath(), m_solution);
+		m_bestLine = m_solution;
+	}
+	else
+		BuildLine(board, search.GetBestPath(), m_bestLine);
+
+	return status;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the moves of the last win found.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The moves are returned, starting from the board passed to Solve().
+*	They are empty if the last search found no win.
+**********************************************************************/
+const Array<Move> & Solver::GetSolution() const
+{
+	return m_solution;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the moves to the most promising position the last search
+*	reached.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The moves are returned, starting from the board passed to Solve()
+*	and including the cards sent home automatically. They are the
+*	solution if a win was found, and empty if no move led anywhere
+*	more promising than the start.
+**********************************************************************/
+const Array<Move> & Solver::GetBestLine() const
+{
+	return m_bestLine;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of positions the last search expanded.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of positions is returned.
+**********************************************************************/
+int Solver::GetNodesExpanded() const
+{
+	return m_nodesExpanded;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of positions the last search stored.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of positions is returned.
+**********************************************************************/
+int Solver::GetNodesStored() const
+{
+	return m_nodesStored;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most positions a search may expand.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The node limit is returned.
+**********************************************************************/
+int Solver::GetNodeLimit() const
+{
+	return m_nodeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the most positions a search may expand.
+*
+* Precondition:
+*	A number of positions.
+*
+* Postcondition:
+*	The node limit is set to the parameter value.
+**********************************************************************/
+void Solver::SetNodeLimit(int nodeLimit)
+{
+	m_nodeLimit = nodeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most bytes a search may use.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The memory limit is returned.
+**********************************************************************/
+size_t Solver::GetMemoryLimit() const
+{
+	return m_memoryLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the most bytes a search may use.
+*
+* Precondition:
+*	A number of bytes.
+*
+* Postcondition:
+*	The memory limit is set to the parameter value.
+**********************************************************************/
+void Solver::SetMemoryLimit(size_t memoryLimit)
+{
+	if (memoryLimit != m_memoryLimit)
+		m_sharedTable.reset();
+
+	m_memoryLimit = memoryLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most milliseconds a search may run.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The time limit is returned, zero for none.
+**********************************************************************/
+int Solver::GetTimeLimit() const
+{
+	return m_timeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the most milliseconds a search may run.
+*
+* Precondition:
+*	A number of milliseconds, or zero for no limit.
+*
+* Postcondition:
+*	The time limit is set to the parameter value.
+**********************************************************************/
+void Solver::SetTimeLimit(int timeLimit)
+{
+	m_timeLimit = timeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of threads a search runs on.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of threads is returned (zero for one per core).
+**********************************************************************/
+int Solver::GetNumThreads() const
+{
+	return m_numThreads;
+}
+
+/**********************************************************************
+* Purpose:
+*	To change the number of threads a search runs on.
+*
+* Precondition:
+*	A number of threads, or zero for one per core.
+*
+* Postcondition:
+*	The number of threads is set to the parameter value.
+**********************************************************************/
+void Solver::SetNumThreads(int numThreads)
+{
+	m_numThreads = numThreads;
+}
+
+/**********************************************************************
+* Purpose:
+*	To estimate how many moves a board is from being won. Every card
+*	not yet home needs a move of its own, and the cards on top of the
+*	next card of each suit to go home must be moved off it first.
+*	Filled free cells count against the board and empty columns count
+*	for it, since both decide how many cards can be moved at once.
+*
+* Precondition:
+*	An existing Board object passed by const ref.
+*
+* Postcondition:
+*	The estimate is returned. It is not a lower bound, so the search
+*	finds short wins rather than the shortest.
+**********************************************************************/
+int Solver::Evaluate(const Board & board)
+{
+	int cardsLeft = NUM_CARDS_DECK - board.GetNumHomeCards();		//Cards not yet home
+	int buried = 0;													//Cards on top of the next card of each suit
+	int filledFreeCells = NUM_FREE_CELLS - board.GetNumEmptyFreeCells();
+
+	for (int column = 0; column < NUM_PLAY_CELLS; column++)
+	{
+		int size = board.GetColumnSize(column);
+
+		for (int depth = 0; depth < size; depth++)
+		{
+			Card card = board.GetColumnCard(column, depth);
+
+			if (card.GetRank() == board.GetHomeHeight(card.GetSuit()) + 1)
+				buried += size - 1 - depth;
+		}
+	}
+
+	return (SOLVER_CARD_WEIGHT * cardsLeft + SOLVER_BURIED_WEIGHT * buried
+		+ SOLVER_FREE_CELL_WEIGHT * filledFreeCells - SOLVER_EMPTY_COLUMN_WEIGHT * board.GetNumEmptyColumns());
+}
+
+/**********************************************************************
+* Purpose:
+*	To store a position and queue it. Room is reserved ahead of time
+*	in steps that never pass the memory limit, rather than letting the
+*	arrays double past it.
+*
+* Precondition:
+*	The position, the index it was reached from, the move that reached
+*	it, and the number of moves that reached it.
+*
+* Postcondition:
+*	True is returned if the position was stored and queued (and kept
+*	as the most promising if its estimate is the lowest yet); false is
+*	returned if the memory limit allows no more positions.
+**********************************************************************/
+bool Solver::AddNode(const Board & board, int parent, const Move & move, int depth)
+{
+	int numNodes = m_nodes.getLength();	//Index of the new position
+
+	if (numNodes >= m_maxNodes)
+		return false;
+
+	if (numNodes == m_nodes.getCapacity())
+	{
+		int capacity = (numNodes < m_maxNodes / 2) ? 2 * numNodes + ARRAY_MIN_CAPACITY : m_maxNodes;
+
+		if (capacity > m_maxNodes)
+			capacity = m_maxNodes;
+
+		m_nodes.reserve(capacity);
+		m_frontier.Reserve(capacity);
+	}
+
+	int score = Evaluate(board);	//Estimated moves left to a win
+
+	if (score < m_bestScore)
+	{
+		m_bestNode = numNodes;
+		m_bestScore = score;
+	}
+
+	m_nodes.push_back(SolverNode(BoardKey(board), board.GetCanonicalHash(), parent, move));
+	m_frontier.Push(SolverEntry(score + depth, numNodes, depth));
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To add the moves that reached a stored position to a path, by
+*	walking back through the parents.
+*
+* Precondition:
+*	The index of a stored position and a path passed by ref.
+*
+* Postcondition:
+*	The moves are added to the end of the path, last first.
+**********************************************************************/
+void Solver::CollectPath(int node, Array<Move> & path) const
+{
+	for (int i = node; m_nodes[i].GetParent() >= 0; i = m_nodes[i].GetParent())
+		path.push_back(m_nodes[i].GetMove());
+}
+
+/**********************************************************************
+* Purpose:
+*	To rebuild a line of moves, such as the winning moves. The moves
+*	of the path are made again from the start, collecting the cards
+*	sent home automatically before and after each one.
+*
+* Precondition:
+*	The board passed to Solve(), passed by const ref, the moves that
+*	reach a position (not counting the cards sent home), last first,
+*	and the line to fill passed by ref.
+*
+* Postcondition:
+*	The line holds every move from the start to the position.
+**********************************************************************/
+void Solver::BuildLine(const Board & start, const Array<Move> & path, Array<Move> & line)
+{
+	Board board = start;				//Board the moves are made on again
+	Move autoMoves[NUM_CARDS_DECK];		//Cards sent home after a move
+	int numAutoMoves = 0;				//Number of cards sent home after a move
+
+	line.resize(0);
+
+	numAutoMoves = board.AutoPlay(autoMoves, NUM_CARDS_DECK);
+
+	for (int i = 0; i < numAutoMoves; i++)
+		line.push_back(autoMoves[i]);
+
+	for (int i = path.getLength() - 1; i >= 0; i--)
+	{
+		board.MakeMove(path[i]);
+		line.push_back(path[i]);
+
+		numAutoMoves = board.AutoPlay(autoMoves, NUM_CARDS_DECK);
+
+		for (int j = 0; j < numAutoMoves; j++)
+			line.push_back(autoMoves[j]);
+	}
+}
@@ -0,0 +1,359 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			solver.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: Solver
+*
+* Purpose:
+*	This class finds a winning sequence of moves for a Board, or shows
+*	there is none. It runs a best-first search: the positions reached
+*	so far wait in a PriorityQueue ordered by an estimate of how far
+*	each is from being won (see Evaluate()) plus how many moves it took
+*	to reach it, and the most promising one is expanded next. Every
+*	move comes from Board::GenerateMoves() and is made with
+*	Board::MakeMove(), so the search follows exactly the rules of the
+*	Board::Move* methods; after each move the cards that are safe to go
+*	home are sent there with Board::AutoPlay().
+*
+*	A TranspositionTable of canonical hashes keeps the search from
+*	reaching the same position twice, counting positions that only
+*	differ by the order of their columns or cells as the same. Each
+*	position is kept as a 40-byte BoardKey with its canonical hash, the
+*	index of the position it came from, and the move that led to it, so
+*	the winning moves are found by walking back from the winning
+*	position, and the table can be rebuilt without decoding any keys.
+*
+*	The search stops when it has expanded the node limit of positions,
+*	would need more than the memory limit to store them, or has run
+*	for its time limit (if it has one). The Solver keeps its storage
+*	between searches, so solving many boards in a row does not
+*	allocate again, and a one-thread search stopped by its time limit
+*	can be continued later from where it stopped. A one-thread search
+*	can also be moved onto a position it stored (see Reroot()), keeping
+*	the positions it found below that one, so a search for a board a
+*	move or two past the one it began from does not start again from
+*	nothing. Whenever a search ends without a win, the moves to the
+*	most promising position it reached are kept as its best line.
+*
+*	Given more than one thread, the search is run by a ParallelSearch
+*	instead, with a queue per thread and work stealing between them
+*	and a lock-free SharedTranspositionTable of fixed size, which is
+*	kept for the next search like the rest of the storage.
+*	With one thread (the default) the search is the same every time it
+*	is run on the same board.
+*
+* Manager functions:
+*	Solver()
+*		Creates a Solver with SOLVER_DEFAULT_NODE_LIMIT and
+*		SOLVER_DEFAULT_MEMORY_LIMIT.
+*
+*	Solver(int nodeLimit, size_t memoryLimit)
+*		Creates a Solver with the given limits.
+*
+*	Solver(const Solver & copy)
+*
+*	~Solver()
+*
+*	Solver & operator=(const Solver & rhs)
+*
+* Methods:
+*	SolveStatus Solve(const Board & board)
+*		Searches for a win from the board and returns SOLVE_SOLVED,
+*		SOLVE_UNSOLVABLE, or the limit that stopped the search.
+*
+*	SolveStatus Continue()
+*		Continues the last search, if its time limit stopped it on one
+*		thread; else, searches again from the board it began from.
+*
+*	bool Reroot(const Board & board)
+*		Makes a position the last one-thread search stored the board it
+*		began from, keeping the positions stored below it and dropping
+*		the rest, so Continue() searches on from the board. Returns
+*		false (and changes nothing) if the board was not stored.
+*
+*	const Array<Move> & GetSolution() const
+*		Returns the moves of the last win found, including the cards
+*		sent home automatically, in the order to make them with
+*		Board::MakeMove().
+*
+*	const Array<Move> & GetBestLine() const
+*		Returns the moves, like GetSolution(), to the most promising
+*		position the last search reached (the win, if it found one).
+*
+*	int GetNodesExpanded() const
+*		Returns the number of positions the last search expanded.
+*
+*	int GetNodesStored() const
+*		Returns the number of positions the last search stored.
+*
+*	int GetNodeLimit() const
+*	void SetNodeLimit(int nodeLimit)
+*		Get and set the most positions a search may expand.
+*
+*	size_t GetMemoryLimit() const
+*	void SetMemoryLimit(size_t memoryLimit)
+*		Get and set the most bytes a search may use for its positions,
+*		its queue, and its table.
+*
+*	int GetTimeLimit() const
+*	void SetTimeLimit(int timeLimit)
+*		Get and set the most milliseconds a search may run (zero for no
+*		limit).
+*
+*	int GetNumThreads() const
+*	void SetNumThreads(int numThreads)
+*		Get and set the number of threads a search runs on (zero for
+*		one per core).
+*
+*	static int Evaluate(const Board & board)
+*		Returns the estimate of how far a board is from being won.
+*
+* SolveStatus
+*	How a search ended.
+*
+* char * SolveStatusMessage(SolveStatus status)
+*	Returns a message describing how a search ended.
+*
+* Class: SolverNode
+*
+* Purpose:
+*	One position stored by the Solver: its BoardKey, its canonical hash,
+*	the index of the position it was reached from (-1 for the starting
+*	position), and the move that reached it.
+*
+* Class: SolverEntry
+*
+* Purpose:
+*	One position waiting in the Solver's queue: its priority, the
+*	index of its SolverNode, and the number of moves that reached it.
+*	Lower priorities come first; of equal priorities, the position
+*	stored last comes first, which keeps the search going deeper.
+**********************************************************************/
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "boardKey.h"
+#include "priorityQueue.h"
+#include "transpositionTable.h"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+const int SOLVER_DEFAULT_NODE_LIMIT = 1000000;							//Positions a search may expand
+const int SOLVER_CLOCK_INTERVAL = 16;									//Positions expanded between looks at the clock
+const size_t SOLVER_DEFAULT_MEMORY_LIMIT = static_cast<size_t>(256) << 20;	//Bytes a search may use
+
+//Weights of Evaluate(), counted in moves
+const int SOLVER_CARD_WEIGHT = 5;			//Each card not yet home
+const int SOLVER_BURIED_WEIGHT = 1;			//Each card above the next card of a suit to go home
+const int SOLVER_FREE_CELL_WEIGHT = 2;		//Each filled free cell
+const int SOLVER_EMPTY_COLUMN_WEIGHT = 3;	//Each empty column (subtracted)
+
+//How a search ended
+enum SolveStatus
+{
+	SOLVE_SOLVED,			//A win was found
+	SOLVE_UNSOLVABLE,		//Every position was searched without a win
+	SOLVE_NODE_LIMIT,		//The node limit was reached
+	SOLVE_MEMORY_LIMIT,		//The memory limit was reached
+	SOLVE_TIME_LIMIT		//The time limit was reached
+};
+
+const int NUM_SOLVE_STATUSES = 5;	//Number of ways a search can end
+
+class SolverNode
+{
+public:
+	//Default Ctor
+	SolverNode();
+
+	//4-Arg Overloaded Ctor
+	SolverNode(const BoardKey & key, unsigned long long hash, int parent, const Move & move);
+
+	//Getter for m_key
+	const BoardKey & GetKey() const;
+
+	//Getter for m_hash
+	unsigned long long GetHash() const;
+
+	//Getter for m_parent
+	int GetParent() const;
+
+	//Getter for m_move
+	Move GetMove() const;
+
+private:
+	BoardKey m_key;				//Position
+	unsigned long long m_hash;	//Its canonical hash
+	int m_parent;		//Index of the position it was reached from, -1 if none
+	Move m_move;		//Move that reached it from the parent
+};
+
+class SolverEntry
+{
+public:
+	//Default Ctor
+	SolverEntry();
+
+	//3-Arg Overloaded Ctor
+	SolverEntry(int priority, int node, int depth);
+
+	//Overloaded < Operator
+	bool operator<(const SolverEntry & rhs) const;
+
+	//Getter for m_priority
+	int GetPriority() const;
+
+	//Getter for m_node
+	int GetNode() const;
+
+	//Getter for m_depth
+	int GetDepth() const;
+
+private:
+	int m_priority;		//Estimated moves to a win through the position
+	int m_node;			//Index of the SolverNode
+	int m_depth;		//Moves made to reach the position
+};
+
+class Solver
+{
+public:
+	//Default Ctor
+	Solver();
+
+	//2-Arg Overloaded Ctor
+	Solver(int nodeLimit, size_t memoryLimit);
+
+	//Copy Ctor
+	Solver(const Solver & copy);
+
+	//Default Dtor
+	~Solver() = default;
+
+	//Assignment Operator
+	Solver & operator=(const Solver & rhs);
+
+	//Searches for a win from the board
+	SolveStatus Solve(const Board & board);
+
+	//Continues the last search where its time limit stopped it
+	SolveStatus Continue();
+
+	//Moves the last search onto a position it stored
+	bool Reroot(const Board & board);
+
+	//Getter for m_solution
+	const Array<Move> & GetSolution() const;
+
+	//Getter for m_bestLine
+	const Array<Move> & GetBestLine() const;
+
+	//Getter for m_nodesExpanded
+	int GetNodesExpanded() const;
+
+	//Getter for m_nodesStored
+	int GetNodesStored() const;
+
+	//Getter for m_nodeLimit
+	int GetNodeLimit() const;
+
+	//Setter for m_nodeLimit
+	void SetNodeLimit(int nodeLimit);
+
+	//Getter for m_memoryLimit
+	size_t GetMemoryLimit() const;
+
+	//Setter for m_memoryLimit
+	void SetMemoryLimit(size_t memoryLimit);
+
+	//Getter for m_timeLimit
+	int GetTimeLimit() const;
+
+	//Setter for m_timeLimit
+	void SetTimeLimit(int timeLimit);
+
+	//Getter for m_numThreads
+	int GetNumThreads() const;
+
+	//Setter for m_numThreads
+	void SetNumThreads(int numThreads);
+
+	//Estimates how far a board is from being won
+	static int Evaluate(const Board & board);
+
+private:
+	//Searches on this thread
+	SolveStatus SolveOneThread(const Board & board, std::chrono::steady_clock::time_point deadline);
+
+	//Expands positions from the queue until the search ends
+	SolveStatus SearchOneThread(const Board & start, std::chrono::steady_clock::time_point deadline);
+
+	//Records how a search on this thread ended and builds its best line
+	void EndOneThread(const Board & start, SolveStatus status);
+
+	//Searches on several threads
+	SolveStatus SolveThreads(const Board & board);
+
+	//Stores a position and queues it, unless the memory limit is reached
+	bool AddNode(const Board & board, int parent, const Move & move, int depth);
+
+	//Adds the moves from the start to a stored position to a path
+	void CollectPath(int node, Array<Move> & path) const;
+
+	//Makes the moves of a path again from the start to build a line of moves
+	static void BuildLine(const Board & start, const Array<Move> & path, Array<Move> & line);
+
+	Array<SolverNode> m_nodes;				//Positions stored, the start first
+	PriorityQueue<SolverEntry> m_frontier;	//Positions waiting to be expanded
+	TranspositionTable m_table;				//Canonical hashes of positions stored
+	std::unique_ptr<SharedTranspositionTable> m_sharedTable;	//Table of the threaded search, made on first use
+	Array<Move> m_solution;					//Moves of the last win found
+	Array<Move> m_bestLine;					//Moves to the most promising position of the last search
+	BoardKey m_start;						//Board the last search began from
+	int m_bestNode;							//Most promising position stored, -1 if none
+	int m_bestScore;						//Its estimate (see Evaluate())
+	bool m_canContinue;						//Flags that the last search can be continued
+	bool m_rerooted;						//Flags that positions were dropped by Reroot()
+	int m_maxNodes;							//Most positions the memory limit allows
+	int m_nodesExpanded;					//Positions expanded by the last search
+	int m_nodesStored;						//Positions stored by the last search
+	int m_nodeLimit;						//Most positions a search may expand
+	size_t m_memoryLimit;					//Most bytes a search may use
+	int m_timeLimit;						//Most milliseconds a search may run, zero for none
+	int m_numThreads;						//Threads a search runs on
+};
+
+/**********************************************************************
+* Purpose:
+*	To return a message describing how a search ended.
+*
+* Precondition:
+*	A SolveStatus.
+*
+* Postcondition:
+*	The message is returned.
+**********************************************************************/
+inline char * SolveStatusMessage(SolveStatus status)
+{
+	switch (status)
+	{
+		case SOLVE_SOLVED:
+			return "The game can be won.";
+		case SOLVE_UNSOLVABLE:
+			return "The game cannot be won.";
+		case SOLVE_NODE_LIMIT:
+			return "ERROR: The search gave up after reaching its node limit.";
+		case SOLVE_MEMORY_LIMIT:
+			return "ERROR: The search gave up after reaching its memory limit.";
+		case SOLVE_TIME_LIMIT:
+			return "ERROR: The search gave up after reaching its time limit.";
+	}
+
+	return "ERROR: Unknown solve status.";
+}
+
+#endif //SOLVER_H
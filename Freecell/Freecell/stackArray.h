@@ -9,6 +9,9 @@
 * Purpose:
 *	This class simulates the stack, and uses an Array object as the
 *	underlying data structure. The stack is a specified fixed size.
+*	The Bounds policy (see bounds.h) decides how Push(), Pop() and
+*	Peek() check for overflow and underflow; the underlying Array is
+*	not checked again.
 *
 * Manager functions:
 *	StackArray()
@@ -25,11 +28,22 @@
 *
 *	StackArray(const StackArray<T> & copy)
 *
+*	StackArray(StackArray<T> && other)
+*		Takes over the underlying Array of other without copying, and
+*		leaves other empty.
+*
 *	~StackArray()
 *
 *	StackArray<T> & operator=(const StackArray<T> & rhs)
 *
+*	StackArray<T> & operator=(StackArray<T> && rhs)
+*		Takes over the underlying Array of rhs without copying, and
+*		leaves rhs empty.
+*
 * Methods:
+*	void Swap(StackArray<T> & other)
+*		Exchanges the contents of two stacks without copying items.
+*
 *	void Push(const T & data)
 *		Pushes its parameter onto the top of the stack.
 *
@@ -54,7 +68,9 @@
 
 #include "array.h"
 
-template <typename T>
+#include <utility>
+
+template <typename T, typename Bounds = DefaultBounds>
 class StackArray
 {
 public:
@@ -65,13 +81,22 @@ public:
 	StackArray(int size);
 
 	//Copy Ctor
-	StackArray(const StackArray<T> & copy);
+	StackArray(const StackArray<T, Bounds> & copy);
+
+	//Move Ctor
+	StackArray(StackArray<T, Bounds> && other) noexcept;
 
 	//Default Dtor
 	~StackArray();
 
 	//Assignment Operator
-	StackArray<T> & operator=(const StackArray<T> & rhs);
+	StackArray<T, Bounds> & operator=(const StackArray<T, Bounds> & rhs);
+
+	//Move Assignment Operator
+	StackArray<T, Bounds> & operator=(StackArray<T, Bounds> && rhs) noexcept;
+
+	//Exchanges the contents of two stacks
+	void Swap(StackArray<T, Bounds> & other) noexcept;
 
 	//Pushes its parameter onto the top of the stack
 	void Push(const T & data);
@@ -92,7 +117,7 @@ public:
 	bool isFull();
 
 private:
-	Array<T> m_stack;	//Underlying stack data structure
+	Array<T, UncheckedBounds> m_stack;	//Underlying stack data structure (the stack checks its own bounds)
 	int m_top;		//References the index of the top item of the stack in the Array
 };
 
@@ -108,8 +133,8 @@ private:
 * Postcondition:
 *	Data members are initialized to default values.
 **********************************************************************/
-template<typename T>
-StackArray<T>::StackArray() : m_top(-1)		//-1 indicates no items on stack since indicies cannot be < 0 
+template<typename T, typename Bounds>
+StackArray<T, Bounds>::StackArray() : m_top(-1)		//-1 indicates no items on stack since indicies cannot be < 0 
 {}
 
 /**********************************************************************
@@ -124,8 +149,8 @@ StackArray<T>::StackArray() : m_top(-1)		//-1 indicates no items on stack since
 * Postcondition:
 *	Data members are initialized to default values.
 **********************************************************************/
-template<typename T>
-StackArray<T>::StackArray(int size) : m_top(-1)		//-1 indicates no items on stack since indicies cannot be < 0 
+template<typename T, typename Bounds>
+StackArray<T, Bounds>::StackArray(int size) : m_top(-1)		//-1 indicates no items on stack since indicies cannot be < 0 
 {
 	if (size < 0)
 	{
@@ -150,10 +175,29 @@ StackArray<T>::StackArray(int size) : m_top(-1)		//-1 indicates no items on stac
 *	The data members are initialized to the values of the data members
 *	of the existing StackArray object.
 **********************************************************************/
-template<typename T>
-StackArray<T>::StackArray(const StackArray<T> & copy) : m_top(-1)	//-1 indicates no items on stack since elements cannot be < 0 
+template<typename T, typename Bounds>
+StackArray<T, Bounds>::StackArray(const StackArray<T, Bounds> & copy) : m_stack(copy.m_stack),		//Use Array's copy Ctor
+m_top(copy.m_top)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a StackArray that takes over the
+*	underlying Array of an existing StackArray object instead of
+*	copying it.
+*
+* Precondition:
+*	An existing StackArray object that is about to be discarded.
+*
+* Postcondition:
+*	This stack holds the items of the other stack, and the other stack
+*	is empty with size zero.
+**********************************************************************/
+template<typename T, typename Bounds>
+StackArray<T, Bounds>::StackArray(StackArray<T, Bounds> && other) noexcept : m_stack(std::move(other.m_stack)),	//Use Array's move Ctor
+m_top(other.m_top)
 {
-	*this = copy;	//Use assignment operator
+	other.m_top = -1;
 }
 
 /**********************************************************************
@@ -167,8 +211,8 @@ StackArray<T>::StackArray(const StackArray<T> & copy) : m_top(-1)	//-1 indicates
 * Postcondition:
 *	Data members are re-initialized to default values.
 **********************************************************************/
-template<typename T>
-StackArray<T>::~StackArray()
+template<typename T, typename Bounds>
+StackArray<T, Bounds>::~StackArray()
 {
 	//Reset to default value
 	m_top = -1;
@@ -187,8 +231,8 @@ StackArray<T>::~StackArray()
 *	One existing StackArray object is assigned to another existing
 *	StackArray object.
 **********************************************************************/
-template<typename T>
-StackArray<T>& StackArray<T>::operator=(const StackArray<T>& rhs)
+template<typename T, typename Bounds>
+StackArray<T, Bounds>& StackArray<T, Bounds>::operator=(const StackArray<T, Bounds>& rhs)
 {
 	//Check for self assignment
 	if (this != &rhs)
@@ -200,6 +244,52 @@ StackArray<T>& StackArray<T>::operator=(const StackArray<T>& rhs)
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To take over the underlying Array of an existing StackArray object
+*	instead of copying it.
+*
+* Precondition:
+*	An existing StackArray object that is about to be discarded.
+*
+* Postcondition:
+*	This stack holds the items of the other stack, and the other stack
+*	is empty with size zero.
+**********************************************************************/
+template<typename T, typename Bounds>
+StackArray<T, Bounds>& StackArray<T, Bounds>::operator=(StackArray<T, Bounds>&& rhs) noexcept
+{
+	//Check for self assignment
+	if (this != &rhs)
+	{
+		m_stack = std::move(rhs.m_stack);	//Use Array's move assignment operator
+		m_top = rhs.m_top;
+		rhs.m_top = -1;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two stacks without copying items.
+*
+* Precondition:
+*	An existing StackArray object passed by ref.
+*
+* Postcondition:
+*	Each stack holds the items the other one held.
+**********************************************************************/
+template<typename T, typename Bounds>
+void StackArray<T, Bounds>::Swap(StackArray<T, Bounds> & other) noexcept
+{
+	m_stack.Swap(other.m_stack);	//Use Array's Swap
+
+	int tempTop = m_top;
+	m_top = other.m_top;
+	other.m_top = tempTop;
+}
+
 /**********************************************************************
 * Purpose:
 *	To add an item to the top of the stack.
@@ -211,12 +301,11 @@ StackArray<T>& StackArray<T>::operator=(const StackArray<T>& rhs)
 *	The item is placed on top of the stack, if the stack is not already
 *	full.
 **********************************************************************/
-template<typename T>
-void StackArray<T>::Push(const T & data)
+template<typename T, typename Bounds>
+void StackArray<T, Bounds>::Push(const T & data)
 {
 	//Check if stack is already full
-	if (isFull())
-		throw Exception("ERROR: Stack overflow detected.");
+	Bounds::Check(!isFull(), "ERROR: Stack overflow detected.");
 
 	m_top++;	//Increment index of top of stack to next index in array
 	m_stack[m_top] = data;		//Place item on top of stack
@@ -232,12 +321,11 @@ void StackArray<T>::Push(const T & data)
 *	The item from the top of the stack is returned and then removed,
 *	if the stack is not already empty.
 **********************************************************************/
-template<typename T>
-T StackArray<T>::Pop()
+template<typename T, typename Bounds>
+T StackArray<T, Bounds>::Pop()
 {
 	//Check if stack is already empty
-	if (isEmpty())
-		throw Exception("ERROR: Stack underflow detected.");
+	Bounds::Check(!isEmpty(), "ERROR: Stack underflow detected.");
 
 	//Return value of top of stack & then decrement index of top of stack to previous index in array
 	return m_stack[m_top--];
@@ -254,12 +342,11 @@ T StackArray<T>::Pop()
 *	The item from the top of the stack is returned, if the stack is
 *	not already empty.
 **********************************************************************/
-template<typename T>
-T StackArray<T>::Peek()
+template<typename T, typename Bounds>
+T StackArray<T, Bounds>::Peek()
 {
 	//Check if stack is already empty
-	if (isEmpty())
-		throw Exception("ERROR: Cannot access top of empty stack.");
+	Bounds::Check(!isEmpty(), "ERROR: Cannot access top of empty stack.");
 
 	//Return value of top of stack
 	return m_stack[m_top];
@@ -275,8 +362,8 @@ T StackArray<T>::Peek()
 * Postcondition:
 *	The number of items on the stack is returned.
 **********************************************************************/
-template<typename T>
-int StackArray<T>::Size()
+template<typename T, typename Bounds>
+int StackArray<T, Bounds>::Size()
 {
 	//Return index value plus one to reference actual number of items on stack
 	return (m_top + 1);
@@ -292,8 +379,8 @@ int StackArray<T>::Size()
 * Postcondition:
 *	A bool is returned signaling whether or not the stack is empty.
 **********************************************************************/
-template<typename T>
-bool StackArray<T>::isEmpty()
+template<typename T, typename Bounds>
+bool StackArray<T, Bounds>::isEmpty()
 {
 	//Returns true if index of top element of stack is less than first index of array
 	return (m_top == -1);
@@ -309,11 +396,28 @@ bool StackArray<T>::isEmpty()
 * Postcondition:
 *	A bool is returned signaling whether or not the stack is full.
 **********************************************************************/
-template<typename T>
-bool StackArray<T>::isFull()
+template<typename T, typename Bounds>
+bool StackArray<T, Bounds>::isFull()
 {
 	//Returns true if index of top element of stack is at the last index of array
 	return (m_top == (m_stack.getLength() - 1));
 }
 
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two stacks (found by argument-dependent
+*	lookup, so generic code that calls swap uses StackArray::Swap).
+*
+* Precondition:
+*	Two existing StackArray objects passed by ref.
+*
+* Postcondition:
+*	Each stack holds the items the other one held.
+**********************************************************************/
+template<typename T, typename Bounds>
+void swap(StackArray<T, Bounds> & lhs, StackArray<T, Bounds> & rhs) noexcept
+{
+	lhs.Swap(rhs);
+}
+
 #endif //STACK_ARRAY_H
\ No newline at end of file
@@ -0,0 +1,364 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			stackFixed.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: StackFixed
+*
+* Purpose:
+*	This class simulates the stack, and stores its items directly
+*	inside the object in a fixed-size array whose capacity is a
+*	template parameter. Unlike StackArray, there is no separate heap
+*	buffer, so pushing and popping never allocate, and copying a
+*	StackFixed of a trivially copyable type is a flat copy of its
+*	bytes. The Bounds policy (see bounds.h) decides how Push(), Pop(),
+*	Peek() and operator[] check for overflow, underflow and bad
+*	depths.
+*
+* Manager functions:
+*	StackFixed()
+*		Creates a StackFixed with the reference to the index of the
+*		top of the stack set to -1 since the stack has no items (since
+*		0 would indicate the stack has 1 item at element zero).
+*
+*	StackFixed(const StackFixed<T, CAPACITY> & copy)
+*
+*	~StackFixed()
+*
+*	StackFixed<T, CAPACITY> & operator=(const StackFixed<T, CAPACITY> & rhs)
+*
+* Methods:
+*	void Push(const T & data)
+*		Pushes its parameter onto the top of the stack.
+*
+*	T Pop()
+*		Removes and returns the data from the top of the stack.
+*
+*	void PushBlock(const T items[], int count)
+*		Pushes count items onto the stack at once, items[0] first, so
+*		the last item ends up on top.
+*
+*	void PopBlock(T items[], int count)
+*		Removes the top count items at once and copies them to items in
+*		the same order they were on the stack (the lowest to items[0]).
+*
+*	T Peek() const
+*		Returns the element on the top of the stack but does not
+*		remove it.
+*
+*	const T & operator[](int index) const
+*		Returns the element at the given depth, counting up from the
+*		bottom of the stack (index 0).
+*
+*	const T & at(int index) const
+*		Returns the element at the given depth like operator[], but
+*		always checks the depth and throws an Exception if it is out of
+*		range.
+*
+*	int Size() const
+*		Returns the number of items currently on the stack.
+*
+*	bool isEmpty() const
+*		Returns true if the stack is empty.
+*
+*	bool isFull() const
+*		Returns true if the stack is full.
+*
+*	void Purge()
+*		Removes all items from the stack.
+**********************************************************************/
+#ifndef STACK_FIXED_H
+#define STACK_FIXED_H
+
+#include "exception.h"
+#include "bounds.h"
+
+template <typename T, int CAPACITY, typename Bounds = DefaultBounds>
+class StackFixed
+{
+public:
+	//Default Ctor
+	StackFixed();
+
+	//Copy Ctor
+	StackFixed(const StackFixed<T, CAPACITY, Bounds> & copy) = default;
+
+	//Default Dtor
+	~StackFixed() = default;
+
+	//Assignment Operator
+	StackFixed<T, CAPACITY, Bounds> & operator=(const StackFixed<T, CAPACITY, Bounds> & rhs) = default;
+
+	//Pushes its parameter onto the top of the stack
+	void Push(const T & data);
+
+	//Removes and returns the data from the top of the stack
+	T Pop();
+
+	//Pushes several items onto the top of the stack, first item lowest
+	void PushBlock(const T items[], int count);
+
+	//Removes several items from the top of the stack, lowest item first
+	void PopBlock(T items[], int count);
+
+	//Returns the element on the top of the stack but does not remove it
+	T Peek() const;
+
+	//Returns the element at a depth counted from the bottom of the stack
+	const T & operator[](int index) const;
+
+	//Returns the element at a depth counted from the bottom, always checked
+	const T & at(int index) const;
+
+	//Returns the number of items currently on the stack
+	int Size() const;
+
+	//Returns true if the stack is empty
+	bool isEmpty() const;
+
+	//Returns true if the stack is full
+	bool isFull() const;
+
+	//Removes all items from the stack
+	void Purge();
+
+private:
+	T m_stack[CAPACITY];	//Underlying stack data structure, stored inline
+	int m_top;		//References the index of the top item of the stack in the array
+};
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a StackFixed and initialize the data
+*	member referencing the index of the top of the stack to the default
+*	value of -1.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Data members are initialized to default values.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+StackFixed<T, CAPACITY, Bounds>::StackFixed() : m_top(-1)		//-1 indicates no items on stack since indicies cannot be < 0
+{}
+
+/**********************************************************************
+* Purpose:
+*	To add an item to the top of the stack.
+*
+* Precondition:
+*	A template type that represents the data item to put on the stack.
+*
+* Postcondition:
+*	The item is placed on top of the stack, if the stack is not already
+*	full.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+void StackFixed<T, CAPACITY, Bounds>::Push(const T & data)
+{
+	//Check if stack is already full
+	Bounds::Check(!isFull(), "ERROR: Stack overflow detected.");
+
+	m_stack[++m_top] = data;	//Place item on top of stack
+}
+
+/**********************************************************************
+* Purpose:
+*	To return and remove an item from the top of the stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The item from the top of the stack is returned and then removed,
+*	if the stack is not already empty.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+T StackFixed<T, CAPACITY, Bounds>::Pop()
+{
+	//Check if stack is already empty
+	Bounds::Check(!isEmpty(), "ERROR: Stack underflow detected.");
+
+	//Return value of top of stack & then decrement index of top of stack to previous index in array
+	return m_stack[m_top--];
+}
+
+/**********************************************************************
+* Purpose:
+*	To add several items to the top of the stack with one bounds check,
+*	keeping their order (items[0] ends up lowest).
+*
+* Precondition:
+*	An array of items and the number of them to put on the stack.
+*
+* Postcondition:
+*	The items are placed on top of the stack, if they all fit.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+void StackFixed<T, CAPACITY, Bounds>::PushBlock(const T items[], int count)
+{
+	//Check if the items all fit
+	Bounds::Check(count >= 0 && m_top + count < CAPACITY, "ERROR: Stack overflow detected.");
+
+	for (int i = 0; i < count; i++)
+		m_stack[m_top + 1 + i] = items[i];
+
+	m_top += count;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove several items from the top of the stack with one bounds
+*	check, copying them out in the order they were on the stack.
+*
+* Precondition:
+*	An array with room for the items and the number of items to remove.
+*
+* Postcondition:
+*	The top count items are copied to the array (the lowest first) and
+*	removed, if the stack has that many.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+void StackFixed<T, CAPACITY, Bounds>::PopBlock(T items[], int count)
+{
+	//Check if the stack has that many items
+	Bounds::Check(count >= 0 && count <= m_top + 1, "ERROR: Stack underflow detected.");
+
+	m_top -= count;
+
+	for (int i = 0; i < count; i++)
+		items[i] = m_stack[m_top + 1 + i];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an item from the top of the stack, but not remove it.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The item from the top of the stack is returned, if the stack is
+*	not already empty.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+T StackFixed<T, CAPACITY, Bounds>::Peek() const
+{
+	//Check if stack is already empty
+	Bounds::Check(!isEmpty(), "ERROR: Cannot access top of empty stack.");
+
+	//Return value of top of stack
+	return m_stack[m_top];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an item at a given depth of the stack without removing
+*	it, counting up from the bottom of the stack.
+*
+* Precondition:
+*	An integer from 0 (bottom of stack) to Size() - 1 (top of stack).
+*
+* Postcondition:
+*	The item at the given depth is returned, if it is on the stack.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+const T & StackFixed<T, CAPACITY, Bounds>::operator[](int index) const
+{
+	//Check if index is below bottom or above top of stack
+	Bounds::Check(index >= 0 && index <= m_top, "ERROR: Stack index out of range.");
+
+	return m_stack[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return an item at a given depth of the stack like operator[],
+*	but always checking the depth whatever the Bounds policy is.
+*
+* Precondition:
+*	An integer from 0 (bottom of stack) to Size() - 1 (top of stack).
+*
+* Postcondition:
+*	The item at the given depth is returned, if it is on the stack;
+*	else, an exception is thrown.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+const T & StackFixed<T, CAPACITY, Bounds>::at(int index) const
+{
+	//Check if index is below bottom or above top of stack
+	CheckedBounds::Check(index >= 0 && index <= m_top, "ERROR: Stack index out of range.");
+
+	return m_stack[index];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of items on the stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of items on the stack is returned.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+int StackFixed<T, CAPACITY, Bounds>::Size() const
+{
+	//Return index value plus one to reference actual number of items on stack
+	return (m_top + 1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not the stack is empty.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A bool is returned signaling whether or not the stack is empty.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+bool StackFixed<T, CAPACITY, Bounds>::isEmpty() const
+{
+	//Returns true if index of top element of stack is less than first index of array
+	return (m_top == -1);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return whether or not the stack if full.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	A bool is returned signaling whether or not the stack is full.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+bool StackFixed<T, CAPACITY, Bounds>::isFull() const
+{
+	//Returns true if index of top element of stack is at the last index of array
+	return (m_top == (CAPACITY - 1));
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove all items from the stack.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The stack is empty.
+**********************************************************************/
+template<typename T, int CAPACITY, typename Bounds>
+void StackFixed<T, CAPACITY, Bounds>::Purge()
+{
+	m_top = -1;
+}
+
+#endif //STACK_FIXED_H
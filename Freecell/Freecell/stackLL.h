@@ -9,7 +9,10 @@
 * Purpose:
 *	This class simulates the stack, and uses a LinkedList object as
 *	the underlying data structure to allow the stack to dynamically
-*	grow as necessary.
+*	grow as necessary. The Allocator policy is passed on to the
+*	LinkedList (see linkedList.h and nodePool.h), and the Bounds policy
+*	(see bounds.h) decides how Pop(), Peek() and Transfer() check for
+*	underflow.
 *
 * Manager functions:
 *	StackLL()
@@ -18,11 +21,22 @@
 *
 *	StackLL(const StackLL<T> & copy)
 *
+*	StackLL(StackLL<T> && other)
+*		Takes over the underlying LinkedList of other without copying,
+*		and leaves other empty.
+*
 *	~StackLL()
 *
 *	StackLL<T> & operator=(const StackLL<T> & rhs)
 *
+*	StackLL<T> & operator=(StackLL<T> && rhs)
+*		Takes over the underlying LinkedList of rhs without copying,
+*		and leaves rhs empty.
+*
 * Methods:
+*	void Swap(StackLL<T> & other)
+*		Exchanges the contents of two stacks without copying items.
+*
 *	void Push(const T & data)
 *		Pushes its parameter onto the top of the stack.
 *
@@ -38,14 +52,22 @@
 *
 *	bool isEmpty()
 *		Returns true if the stack is empty.
+*
+*	void Transfer(StackLL<T> & destination, int numItems)
+*		Moves the top numItems items onto the top of another stack,
+*		keeping their order, by relinking nodes instead of popping and
+*		pushing each item.
 **********************************************************************/
 #ifndef STACK_LL_H
 #define STACK_LL_H
 
 #include "linkedList.h"
 #include "exception.h"
+#include "bounds.h"
+
+#include <utility>
 
-template <typename T>
+template <typename T, typename Allocator = HeapNodeAllocator, typename Bounds = DefaultBounds>
 class StackLL
 {
 public:
@@ -53,13 +75,22 @@ public:
 	StackLL();
 
 	//Copy Ctor
-	StackLL(const StackLL<T> & copy);
+	StackLL(const StackLL<T, Allocator, Bounds> & copy);
+
+	//Move Ctor
+	StackLL(StackLL<T, Allocator, Bounds> && other) noexcept;
 
 	//Default Dtor
 	~StackLL();
 
 	//Assignment Operator
-	StackLL<T> & operator=(const StackLL<T> & rhs);
+	StackLL<T, Allocator, Bounds> & operator=(const StackLL<T, Allocator, Bounds> & rhs);
+
+	//Move Assignment Operator
+	StackLL<T, Allocator, Bounds> & operator=(StackLL<T, Allocator, Bounds> && rhs) noexcept;
+
+	//Exchanges the contents of two stacks
+	void Swap(StackLL<T, Allocator, Bounds> & other) noexcept;
 
 	//Pushes its parameter onto the top of the stack
 	void Push(const T & data);
@@ -76,8 +107,11 @@ public:
 	//Returns true if the stack is empty
 	bool isEmpty();
 
+	//Moves the top items onto another stack, keeping their order
+	void Transfer(StackLL<T, Allocator, Bounds> & destination, int numItems);
+
 private:
-	LinkedList<T> m_stack;	//Underlying stack data structure
+	LinkedList<T, Allocator> m_stack;	//Underlying stack data structure
 	int m_size;		//Contains number of items on the stack
 };
 
@@ -92,8 +126,8 @@ private:
 * Postcondition:
 *	Data members are initialized to default values.
 **********************************************************************/
-template<typename T>
-StackLL<T>::StackLL() : m_size(0)
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>::StackLL() : m_size(0)
 {}
 
 /**********************************************************************
@@ -109,10 +143,29 @@ StackLL<T>::StackLL() : m_size(0)
 *	The data members are initialized to the values of the data members
 *	of the existing StackLL object.
 **********************************************************************/
-template<typename T>
-StackLL<T>::StackLL(const StackLL<T>& copy) : m_size(0)
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>::StackLL(const StackLL<T, Allocator, Bounds>& copy) : m_stack(copy.m_stack),	//Use LinkedList's copy Ctor
+m_size(copy.m_size)
+{}
+
+/**********************************************************************
+* Purpose:
+*	To construct an instance of a StackLL that takes over the
+*	underlying LinkedList of an existing StackLL object instead of
+*	copying it.
+*
+* Precondition:
+*	An existing StackLL object that is about to be discarded.
+*
+* Postcondition:
+*	This stack holds the items of the other stack, and the other stack
+*	is empty.
+**********************************************************************/
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>::StackLL(StackLL<T, Allocator, Bounds>&& other) noexcept : m_stack(std::move(other.m_stack)),	//Use LinkedList's move Ctor
+m_size(other.m_size)
 {
-	*this = copy;	//Use assignment operator
+	other.m_size = 0;
 }
 
 /**********************************************************************
@@ -126,8 +179,8 @@ StackLL<T>::StackLL(const StackLL<T>& copy) : m_size(0)
 * Postcondition:
 *	Data members are re-initialized to default values.
 **********************************************************************/
-template<typename T>
-StackLL<T>::~StackLL()
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>::~StackLL()
 {
 	//Reset to default values
 	m_size = 0;
@@ -145,15 +198,63 @@ StackLL<T>::~StackLL()
 *	One existing StackLL object is assigned to another existing
 *	StackLL object.
 **********************************************************************/
-template<typename T>
-StackLL<T>& StackLL<T>::operator=(const StackLL<T>& rhs)
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>& StackLL<T, Allocator, Bounds>::operator=(const StackLL<T, Allocator, Bounds>& rhs)
 {
 	if (this != &rhs)
+	{
 		m_stack = rhs.m_stack;	//Use LinkedList's assignment operator
+		m_size = rhs.m_size;
+	}
 
 	return *this;
 }
 
+/**********************************************************************
+* Purpose:
+*	To take over the underlying LinkedList of an existing StackLL
+*	object instead of copying it.
+*
+* Precondition:
+*	An existing StackLL object that is about to be discarded.
+*
+* Postcondition:
+*	This stack holds the items of the other stack, and the other stack
+*	is empty.
+**********************************************************************/
+template<typename T, typename Allocator, typename Bounds>
+StackLL<T, Allocator, Bounds>& StackLL<T, Allocator, Bounds>::operator=(StackLL<T, Allocator, Bounds>&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		m_stack = std::move(rhs.m_stack);	//Use LinkedList's move assignment operator
+		m_size = rhs.m_size;
+		rhs.m_size = 0;
+	}
+
+	return *this;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two stacks without copying items.
+*
+* Precondition:
+*	An existing StackLL object passed by ref.
+*
+* Postcondition:
+*	Each stack holds the items the other one held.
+**********************************************************************/
+template<typename T, typename Allocator, typename Bounds>
+void StackLL<T, Allocator, Bounds>::Swap(StackLL<T, Allocator, Bounds> & other) noexcept
+{
+	m_stack.Swap(other.m_stack);	//Use LinkedList's Swap
+
+	int tempSize = m_size;
+	m_size = other.m_size;
+	other.m_size = tempSize;
+}
+
 /**********************************************************************
 * Purpose:
 *	To add an item to the top of the stack.
@@ -164,8 +265,8 @@ StackLL<T>& StackLL<T>::operator=(const StackLL<T>& rhs)
 * Postcondition:
 *	The item is placed on top of the stack.
 **********************************************************************/
-template<typename T>
-void StackLL<T>::Push(const T & data)
+template<typename T, typename Allocator, typename Bounds>
+void StackLL<T, Allocator, Bounds>::Push(const T & data)
 {
 	m_stack.Prepend(data);	//Add node to front of linked list to put item at top of stack
 	m_size++;	//Increment number of items on stack
@@ -182,18 +283,15 @@ void StackLL<T>::Push(const T & data)
 *	The item from the top of the stack is returned and then removed,
 *	if the stack is not already empty.
 **********************************************************************/
-template<typename T>
-T StackLL<T>::Pop()
+template<typename T, typename Allocator, typename Bounds>
+T StackLL<T, Allocator, Bounds>::Pop()
 {
 	//Check if stack is already empty
-	if (isEmpty())
-		throw Exception("ERROR: Stack underflow detected.");
+	Bounds::Check(!isEmpty(), "ERROR: Stack underflow detected.");
 
-	T top = m_stack.First();	//Store value of item at top of stack
-	m_stack.Extract(top);	//Remove first node of linked list to delete item at top of stack
 	m_size--;	//Decrement number of items on stack
 
-	return top;		//Return value of item previously at top of stack
+	return m_stack.PopFront();	//Remove first node of linked list and return item previously at top of stack
 }
 
 /**********************************************************************
@@ -207,12 +305,11 @@ T StackLL<T>::Pop()
 *	The item from the top of the stack is returned, if the stack is
 *	not already empty.
 **********************************************************************/
-template<typename T>
-T StackLL<T>::Peek()
+template<typename T, typename Allocator, typename Bounds>
+T StackLL<T, Allocator, Bounds>::Peek()
 {
 	//Check if stack is already empty
-	if (isEmpty())
-		throw Exception("ERROR: Cannot access top of an empty stack.");
+	Bounds::Check(!isEmpty(), "ERROR: Cannot access top of an empty stack.");
 
 	return (m_stack.First());		//Return value of item at top of stack
 }
@@ -227,8 +324,8 @@ T StackLL<T>::Peek()
 * Postcondition:
 *	The number of items on the stack is returned.
 **********************************************************************/
-template<typename T>
-int StackLL<T>::Size()
+template<typename T, typename Allocator, typename Bounds>
+int StackLL<T, Allocator, Bounds>::Size()
 {
 	return m_size;	//Return number of items on stack
 }
@@ -243,10 +340,63 @@ int StackLL<T>::Size()
 * Postcondition:
 *	A bool is returned signaling whether or not the stack is empty.
 **********************************************************************/
-template<typename T>
-bool StackLL<T>::isEmpty()
+template<typename T, typename Allocator, typename Bounds>
+bool StackLL<T, Allocator, Bounds>::isEmpty()
 {
 	return (m_stack.isEmpty());		//Returns true if linked list is empty
 }
 
+/**********************************************************************
+* Purpose:
+*	To move the top items of the stack onto the top of another stack,
+*	keeping their order (the item on top of this stack ends up on top
+*	of the destination). The nodes are relinked rather than copied, so
+*	nothing is allocated or deleted.
+*
+* Precondition:
+*	A different StackLL object and the number of items to move.
+*
+* Postcondition:
+*	The items are moved, if this stack has that many items.
+**********************************************************************/
+template<typename T, typename Allocator, typename Bounds>
+void StackLL<T, Allocator, Bounds>::Transfer(StackLL<T, Allocator, Bounds> & destination, int numItems)
+{
+	//Check if stack has enough items
+	Bounds::Check(numItems >= 0 && numItems <= m_size, "ERROR: Stack underflow detected.");
+
+	//Check if moving onto the same stack
+	if (&destination == this)
+		throw Exception("ERROR: Cannot transfer items onto the same stack.");
+
+	typename LinkedList<T, Allocator>::Iterator last = m_stack.Begin();	//One past the last item being moved
+
+	//Find end of the items being moved
+	for (int i = 0; i < numItems; i++)
+		++last;
+
+	//Relink items to front of destination list to put them on top of destination stack
+	destination.m_stack.Splice(destination.m_stack.Begin(), m_stack, m_stack.Begin(), last);
+
+	m_size -= numItems;
+	destination.m_size += numItems;
+}
+
+/**********************************************************************
+* Purpose:
+*	To exchange the contents of two stacks (found by argument-dependent
+*	lookup, so generic code that calls swap uses StackLL::Swap).
+*
+* Precondition:
+*	Two existing StackLL objects passed by ref.
+*
+* Postcondition:
+*	Each stack holds the items the other one held.
+**********************************************************************/
+template<typename T, typename Allocator, typename Bounds>
+void swap(StackLL<T, Allocator, Bounds> & lhs, StackLL<T, Allocator, Bounds> & rhs) noexcept
+{
+	lhs.Swap(rhs);
+}
+
 #endif //STACK_LL_H
\ No newline at end of file
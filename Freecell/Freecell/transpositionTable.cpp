@@ -0,0 +1,378 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			transpositionTable.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "transpositionTable.h"
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty TranspositionTable that may grow to any
+*	size.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The table has TT_MIN_CAPACITY empty slots.
+**********************************************************************/
+TranspositionTable::TranspositionTable() : m_size(0), m_maxCapacity(TT_MAX_CAPACITY)
+{
+	m_slots.resize(TT_MIN_CAPACITY);
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty TranspositionTable with a limit on how large
+*	it may grow.
+*
+* Precondition:
+*	The most slots the table may have.
+*
+* Postcondition:
+*	The table has empty slots, and never grows past the limit rounded
+*	down to a power of two.
+**********************************************************************/
+TranspositionTable::TranspositionTable(int maxCapacity) : m_size(0), m_maxCapacity(TT_MAX_CAPACITY)
+{
+	SetMaxCapacity(maxCapacity);
+	m_slots.resize((m_maxCapacity < TT_MIN_CAPACITY) ? m_maxCapacity : TT_MIN_CAPACITY);
+}
+
+/**********************************************************************
+* Purpose:
+*	To store a hash if it is not stored yet. The table doubles first
+*	if it is three quarters full and allowed to grow.
+*
+* Precondition:
+*	A 64-bit hash.
+*
+* Postcondition:
+*	True is returned if the hash was stored; false is returned if it
+*	was already stored or the table is full.
+**********************************************************************/
+bool TranspositionTable::Insert(unsigned long long hash)
+{
+	if (hash == 0)
+		hash = 1;
+
+	if (4 * (m_size + 1) > 3 * m_slots.getLength())
+	{
+		if (m_slots.getLength() >= m_maxCapacity)
+			return false;
+
+		Grow();
+	}
+
+	int slot = FindSlot(hash);	//Slot holding the hash, or the empty slot for it
+
+	if (m_slots[slot] == hash)
+		return false;
+
+	m_slots[slot] = hash;
+	m_size++;
+
+	return true;
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether a hash is stored.
+*
+* Precondition:
+*	A 64-bit hash.
+*
+* Postcondition:
+*	True is returned if the hash is stored.
+**********************************************************************/
+bool TranspositionTable::Contains(unsigned long long hash) const
+{
+	if (hash == 0)
+		hash = 1;
+
+	return (m_slots[FindSlot(hash)] == hash);
+}
+
+/**********************************************************************
+* Purpose:
+*	To check whether the table can take another hash.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	True is returned if the table is three quarters full and may not
+*	grow.
+**********************************************************************/
+bool TranspositionTable::isFull() const
+{
+	return (4 * (m_size + 1) > 3 * m_slots.getLength() && m_slots.getLength() >= m_maxCapacity);
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of hashes stored.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of hashes is returned.
+**********************************************************************/
+int TranspositionTable::GetSize() const
+{
+	return m_size;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of slots in the table.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of slots is returned.
+**********************************************************************/
+int TranspositionTable::GetCapacity() const
+{
+	return m_slots.getLength();
+}
+
+/**********************************************************************
+* Purpose:
+*	To change how large the table may grow. The table does not shrink
+*	if it is already larger.
+*
+* Precondition:
+*	The most slots the table may have, at least one.
+*
+* Postcondition:
+*	The limit is the largest power of two no greater than the
+*	parameter (and no greater than TT_MAX_CAPACITY).
+**********************************************************************/
+void TranspositionTable::SetMaxCapacity(int maxCapacity)
+{
+	m_maxCapacity = 1;
+
+	while (m_maxCapacity < TT_MAX_CAPACITY && 2 * m_maxCapacity <= maxCapacity)
+		m_maxCapacity *= 2;
+}
+
+/**********************************************************************
+* Purpose:
+*	To remove every hash. The slots are kept, so a table reused for
+*	another search does not grow again.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	Every slot is empty.
+**********************************************************************/
+void TranspositionTable::Clear()
+{
+	for (int i = 0; i < m_slots.getLength(); i++)
+		m_slots[i] = 0;
+
+	m_size = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To double the number of slots. Each hash's slot depends on the
+*	number of slots, so every hash is stored again.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The table has twice as many slots and the same hashes.
+**********************************************************************/
+void TranspositionTable::Grow()
+{
+	Array<unsigned long long, UncheckedBounds> oldSlots;	//Takes the old slots
+
+	//Resizing an empty Array fills every new slot with zero
+	oldSlots.Swap(m_slots);
+	m_slots.resize(2 * oldSlots.getLength());
+
+	for (int i = 0; i < oldSlots.getLength(); i++)
+	{
+		if (oldSlots[i] != 0)
+			m_slots[FindSlot(oldSlots[i])] = oldSlots[i];
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To find the slot of a hash. The high bits of the hash choose the
+*	first slot to look in (the low bits already choose buckets in other
+*	tables), then the following slots are tried in turn.
+*
+* Precondition:
+*	A non-zero 64-bit hash. The table has at least one empty slot.
+*
+* Postcondition:
+*	The index of the slot holding the hash is returned, or of the
+*	empty slot where it would go.
+**********************************************************************/
+int TranspositionTable::FindSlot(unsigned long long hash) const
+{
+	int mask = m_slots.getLength() - 1;	//Slot count is a power of two
+	int slot = static_cast<int>(hash >> 34) & mask;
+
+	while (m_slots[slot] != 0 && m_slots[slot] != hash)
+		slot = (slot + 1) & mask;
+
+	return slot;
+}
+
+/**********************************************************************
+* Purpose:
+*	To construct an empty SharedTranspositionTable with as many slots
+*	as fit in a memory limit. Every slot is allocated here, once.
+*
+* Precondition:
+*	The most bytes the slots may use.
+*
+* Postcondition:
+*	The table has the largest power of two of slots that fits in the
+*	limit (at least one bucket, at most TT_MAX_CAPACITY), all empty.
+**********************************************************************/
+SharedTranspositionTable::SharedTranspositionTable(size_t memoryLimit) : m_capacity(TT_BUCKET_SLOTS), m_age(1)
+{
+	while (m_capacity < TT_MAX_CAPACITY && static_cast<size_t>(m_capacity) * 2 * sizeof(unsigned long long) <= memoryLimit)
+		m_capacity *= 2;
+
+	m_slots.reset(new std::atomic<unsigned long long>[m_capacity]);
+	Clear();
+}
+
+/**********************************************************************
+* Purpose:
+*	To store a hash if this search has not reached it yet, or has only
+*	reached it after more moves. The bucket of the hash is read slot by
+*	slot; slots fill from the front and never empty again until the
+*	table is cleared, so the first empty slot ends the bucket. The new
+*	entry goes into the slot matching the hash, else the first empty
+*	slot, else the entry least worth keeping, using compare-and-swap;
+*	if another thread changed that slot first, the bucket is read
+*	again.
+*
+* Precondition:
+*	A 64-bit hash and the number of moves that reached the position.
+*	No thread is calling NewSearch() or Clear().
+*
+* Postcondition:
+*	True is returned if the hash was stored; false is returned if this
+*	search had already stored it with the same depth or less.
+**********************************************************************/
+bool SharedTranspositionTable::Insert(unsigned long long hash, int depth)
+{
+	unsigned long long tag = hash & TT_TAG_MASK;	//High bits of the hash
+	unsigned long long entry = tag | m_age
+		| (static_cast<unsigned long long>((depth < TT_MAX_DEPTH) ? depth : TT_MAX_DEPTH) << TT_DEPTH_SHIFT);
+	std::atomic<unsigned long long> * bucket = &m_slots[static_cast<int>(hash) & (m_capacity - 1) & ~(TT_BUCKET_SLOTS - 1)];
+
+	for (;;)
+	{
+		int victim = 0;							//Slot the entry goes into
+		unsigned long long victimEntry = 0;		//What that slot holds now
+		int victimScore = -1;					//How little the slot is worth keeping
+
+		for (int i = 0; i < TT_BUCKET_SLOTS; i++)
+		{
+			unsigned long long current = bucket[i].load(std::memory_order_relaxed);	//Entry in the slot
+			int score = 0;						//How little the entry is worth keeping
+
+			if (current == 0)
+			{
+				victim = i;
+				victimEntry = 0;
+				break;
+			}
+
+			if ((current & TT_MAX_AGE) != m_age)
+				score = TT_MAX_DEPTH + 1;		//Stored by an earlier search
+			else if ((current & TT_TAG_MASK) == tag)
+			{
+				if (static_cast<int>((current >> TT_DEPTH_SHIFT) & TT_MAX_DEPTH) <= depth)
+					return false;
+
+				//Reached in fewer moves than before, so keep the lower depth
+				victim = i;
+				victimEntry = current;
+				break;
+			}
+			else
+				score = static_cast<int>((current >> TT_DEPTH_SHIFT) & TT_MAX_DEPTH);
+
+			if (score > victimScore)
+			{
+				victim = i;
+				victimEntry = current;
+				victimScore = score;
+			}
+		}
+
+		if (bucket[victim].compare_exchange_strong(victimEntry, entry, std::memory_order_relaxed))
+			return true;
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To start a new search by moving to the next age, so the entries of
+*	earlier searches are never matched and are the first replaced. When
+*	the ages run out the slots are emptied instead, so an old entry is
+*	never taken for a new one.
+*
+* Precondition:
+*	No thread is calling Insert().
+*
+* Postcondition:
+*	No hash stored so far is matched by Insert().
+**********************************************************************/
+void SharedTranspositionTable::NewSearch()
+{
+	if (m_age == TT_MAX_AGE)
+		Clear();
+	else
+		m_age++;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of slots.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of slots is returned.
+**********************************************************************/
+int SharedTranspositionTable::GetCapacity() const
+{
+	return m_capacity;
+}
+
+/**********************************************************************
+* Purpose:
+*	To empty every slot and start again from the first age.
+*
+* Precondition:
+*	No thread is calling Insert().
+*
+* Postcondition:
+*	Every slot is empty.
+**********************************************************************/
+void SharedTranspositionTable::Clear()
+{
+	for (int i = 0; i < m_capacity; i++)
+		m_slots[i].store(0, std::memory_order_relaxed);
+
+	m_age = 1;
+}
@@ -0,0 +1,215 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			transpositionTable.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: TranspositionTable
+*
+* Purpose:
+*	This class remembers which positions a search has already reached,
+*	so the Solver never expands the same position twice. A position is
+*	stored as its 64-bit canonical hash (Board::GetCanonicalHash()),
+*	which is the same for every arrangement of the same columns and
+*	cells, so each slot is a single word in one flat open-addressed
+*	table with linear probing. Zero marks an empty slot; a hash of zero
+*	is stored as one.
+*
+*	Two different positions sharing a hash would make the search skip
+*	the second one. With 64-bit hashes that is unlikely enough to
+*	ignore, and it can only lose a solution, never make a wrong one,
+*	since every move of a solution is checked by the Board.
+*
+*	The table starts small and doubles whenever it is three quarters
+*	full, up to the largest capacity it is allowed.
+*
+* Manager functions:
+*	TranspositionTable()
+*		Creates an empty table with TT_MIN_CAPACITY slots and no limit
+*		on growing.
+*
+*	TranspositionTable(int maxCapacity)
+*		Creates an empty table that never grows past maxCapacity slots
+*		(rounded down to a power of two).
+*
+*	TranspositionTable(const TranspositionTable & copy)
+*
+*	~TranspositionTable()
+*
+*	TranspositionTable & operator=(const TranspositionTable & rhs)
+*
+* Methods:
+*	bool Insert(unsigned long long hash)
+*		Stores a hash and returns true, or returns false if it was
+*		already stored or the table is full.
+*
+*	bool Contains(unsigned long long hash) const
+*		Returns true if the hash is stored.
+*
+*	bool isFull() const
+*		Returns true if the table can take no more hashes.
+*
+*	int GetSize() const
+*		Returns the number of hashes stored.
+*
+*	int GetCapacity() const
+*		Returns the number of slots.
+*
+*	void SetMaxCapacity(int maxCapacity)
+*		Changes how large the table may grow.
+*
+*	void Clear()
+*		Removes every hash, keeping the slots.
+*
+* Class: SharedTranspositionTable
+*
+* Purpose:
+*	A transposition table that several threads can use at once without
+*	ever waiting for each other. Its slots are allocated once, from a
+*	memory limit, and never grow, so a search may run as long as it
+*	likes without the table using more memory.
+*
+*	Each slot is one atomic word holding the high bits of a hash, the
+*	number of moves that reached the position (its depth), and the
+*	search it was stored by (its age). The low bits of a hash choose a
+*	bucket of TT_BUCKET_SLOTS slots, and Insert() looks up and stores a
+*	hash in that bucket with compare-and-swap alone: a thread that
+*	loses a race for a slot simply looks at the bucket again.
+*
+*	When a bucket has no room, the new hash replaces an entry stored by
+*	an earlier search if there is one, else the deepest entry, since a
+*	position far from the start is the least likely to be reached again
+*	by another line of moves. A replaced position can be searched a
+*	second time, which costs time but never gives a wrong answer.
+*	Entries stored by an earlier search are never matched, so calling
+*	NewSearch() empties the table for a new search without touching
+*	its slots.
+*
+*	Two threads storing the same new hash at the same moment can both
+*	be told it is new, and the position is searched twice; this is
+*	rare and harmless.
+*
+* Manager functions:
+*	SharedTranspositionTable(size_t memoryLimit)
+*		Creates an empty table with as many slots as fit in
+*		memoryLimit bytes (a power of two, at least one bucket).
+*
+* Methods:
+*	bool Insert(unsigned long long hash, int depth)
+*		Stores a hash reached after depth moves and returns true if it
+*		was not stored by this search, or was only stored deeper;
+*		else, returns false.
+*
+*	void NewSearch()
+*		Starts a new search, so no hash stored so far is matched.
+*
+*	int GetCapacity() const
+*		Returns the number of slots.
+*
+*	void Clear()
+*		Empties every slot.
+**********************************************************************/
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include "array.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+const int TT_MIN_CAPACITY = 1 << 12;	//Slots a table starts with
+const int TT_MAX_CAPACITY = 1 << 30;	//Most slots any table may have
+
+//Layout of a SharedTranspositionTable slot
+const int TT_BUCKET_SLOTS = 4;							//Slots a hash may be stored in
+const unsigned long long TT_TAG_MASK = ~0xFFFFULL;		//Bits holding the high bits of the hash
+const int TT_DEPTH_SHIFT = 8;							//Lowest bit of the depth
+const int TT_MAX_DEPTH = 0xFF;							//Largest depth stored, deeper counts as this
+const int TT_MAX_AGE = 0xFF;							//Largest age, also the mask of the age bits
+
+class TranspositionTable
+{
+public:
+	//Default Ctor
+	TranspositionTable();
+
+	//1-Arg Overloaded Ctor
+	explicit TranspositionTable(int maxCapacity);
+
+	//Copy Ctor
+	TranspositionTable(const TranspositionTable & copy) = default;
+
+	//Default Dtor
+	~TranspositionTable() = default;
+
+	//Assignment Operator
+	TranspositionTable & operator=(const TranspositionTable & rhs) = default;
+
+	//Stores a hash and returns true if it was not stored yet
+	bool Insert(unsigned long long hash);
+
+	//Returns true if the hash is stored
+	bool Contains(unsigned long long hash) const;
+
+	//Returns true if the table can take no more hashes
+	bool isFull() const;
+
+	//Getter for m_size
+	int GetSize() const;
+
+	//Returns the number of slots
+	int GetCapacity() const;
+
+	//Setter for m_maxCapacity
+	void SetMaxCapacity(int maxCapacity);
+
+	//Removes every hash
+	void Clear();
+
+private:
+	//Doubles the number of slots and stores every hash again
+	void Grow();
+
+	//Returns the slot a hash is in, or the empty slot it would go in
+	int FindSlot(unsigned long long hash) const;
+
+	Array<unsigned long long, UncheckedBounds> m_slots;	//Stored hashes, zero for an empty slot
+	int m_size;				//Number of hashes stored
+	int m_maxCapacity;		//Most slots the table may grow to
+};
+
+class SharedTranspositionTable
+{
+public:
+	//1-Arg Overloaded Ctor
+	explicit SharedTranspositionTable(size_t memoryLimit);
+
+	//Copy Ctor (not allowed, the slots are shared by threads)
+	SharedTranspositionTable(const SharedTranspositionTable & copy) = delete;
+
+	//Default Dtor
+	~SharedTranspositionTable() = default;
+
+	//Assignment Operator (not allowed, the slots are shared by threads)
+	SharedTranspositionTable & operator=(const SharedTranspositionTable & rhs) = delete;
+
+	//Stores a hash and returns true if this search has not reached it as quickly yet
+	bool Insert(unsigned long long hash, int depth);
+
+	//Starts a new search, forgetting every hash stored so far
+	void NewSearch();
+
+	//Getter for m_capacity
+	int GetCapacity() const;
+
+	//Empties every slot
+	void Clear();
+
+private:
+	std::unique_ptr<std::atomic<unsigned long long>[]> m_slots;	//Entries, zero for an empty slot
+	int m_capacity;						//Number of slots, a power of two
+	unsigned long long m_age;			//Age of the current search, never zero
+};
+
+#endif //TRANSPOSITION_TABLE_H
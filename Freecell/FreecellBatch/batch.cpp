@@ -0,0 +1,154 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			batch.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Overview:
+*	This program solves a range of Freecell deals without a player, so
+*	large sets of deals can be sorted into those that can be won and
+*	those that cannot. Every core solves deals at once (see
+*	BatchRunner), and one line is written for each deal.
+*
+* Input:
+*	The command line:
+*		FreecellBatch first last [-seeds] [-threads n] [-nodes n]
+*			[-memory mb] [-out file]
+*	first and last are the range of deals (inclusive), which are game
+*	numbers unless -seeds is given. -threads sets the number of threads
+*	(default one per core), -nodes the most positions each deal's
+*	search may expand, and -memory the most megabytes each deal's
+*	search may use.
+*
+* Output:
+*	One line of comma separated values per deal (deal, status, solution
+*	length, nodes expanded, milliseconds) is written to the file given
+*	by -out, or to the screen. A summary of the run is written to the
+*	error stream.
+**********************************************************************/
+
+#include "batchRunner.h"
+#include "exception.h"
+
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+using std::cout;
+using std::cerr;
+using std::endl;
+
+/**********************************************************************
+* Purpose:
+*	To read a whole number from a command line argument.
+*
+* Precondition:
+*	The argument and where to put its value.
+*
+* Postcondition:
+*	True is returned and the value is set if the whole argument is a
+*	number; else, false is returned.
+**********************************************************************/
+bool ReadNumber(const char * arg, unsigned long long & value)
+{
+	char * end = nullptr;	//Where the number stopped
+
+	if (*arg < '0' || *arg > '9')
+		return false;
+
+	value = strtoull(arg, &end, 10);
+
+	return *end == '\0';
+}
+
+/**********************************************************************
+* Purpose:
+*	To show how the program is run.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The usage is written to the error stream.
+**********************************************************************/
+void ShowUsage()
+{
+	cerr << "Usage: FreecellBatch first last [-seeds] [-threads n] [-nodes n] [-memory mb] [-out file]" << endl;
+}
+
+int main(int argc, char * argv[])
+{
+	unsigned long long first = 0;			//First deal
+	unsigned long long last = 0;			//Last deal
+	bool seeded = false;					//Flags that deals are seeds
+	unsigned long long numThreads = 0;		//Threads to run, zero for one per core
+	unsigned long long nodeLimit = SOLVER_DEFAULT_NODE_LIMIT;				//Positions each search may expand
+	unsigned long long memoryLimit = BATCH_DEFAULT_MEMORY_LIMIT >> 20;	//Megabytes each search may use
+	const char * outName = nullptr;			//File to write to, none for the screen
+	bool valid = argc >= 3 && ReadNumber(argv[1], first) && ReadNumber(argv[2], last);	//Flags good arguments
+
+	for (int i = 3; valid && i < argc; i++)
+	{
+		if (strcmp(argv[i], "-seeds") == 0)
+			seeded = true;
+		else if (i + 1 >= argc)
+			valid = false;
+		else if (strcmp(argv[i], "-threads") == 0)
+			valid = ReadNumber(argv[++i], numThreads) && numThreads <= 1024;
+		else if (strcmp(argv[i], "-nodes") == 0)
+			valid = ReadNumber(argv[++i], nodeLimit) && nodeLimit > 0 && nodeLimit <= INT_MAX;
+		else if (strcmp(argv[i], "-memory") == 0)
+			valid = ReadNumber(argv[++i], memoryLimit) && memoryLimit > 0 && memoryLimit <= (SIZE_MAX >> 20);
+		else if (strcmp(argv[i], "-out") == 0)
+			outName = argv[++i];
+		else
+			valid = false;
+	}
+
+	if (!valid || first > last || (!seeded && last > UINT_MAX))
+	{
+		ShowUsage();
+		return 1;
+	}
+
+	try
+	{
+		BatchRunner runner(first, last, seeded);	//Solves the deals
+		std::ofstream outFile;						//File the lines go to, if any
+
+		runner.SetNumThreads(static_cast<int>(numThreads));
+		runner.SetNodeLimit(static_cast<int>(nodeLimit));
+		runner.SetMemoryLimit(static_cast<size_t>(memoryLimit) << 20);
+
+		if (outName != nullptr)
+		{
+			outFile.open(outName);
+
+			if (!outFile)
+				throw Exception("ERROR: The output file could not be opened.");
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();	//When the run began
+
+		runner.Run((outName != nullptr) ? outFile : cout);
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;	//Length of the run
+		double numDeals = static_cast<double>(last - first) + 1;	//Deals solved
+
+		cerr << "Solved: " << runner.GetNumResults(SOLVE_SOLVED)
+			<< "  Unsolvable: " << runner.GetNumResults(SOLVE_UNSOLVABLE)
+			<< "  Node limit: " << runner.GetNumResults(SOLVE_NODE_LIMIT)
+			<< "  Memory limit: " << runner.GetNumResults(SOLVE_MEMORY_LIMIT) << endl;
+		cerr << "Seconds: " << elapsed.count() << "  Deals per second: " << numDeals / elapsed.count() << endl;
+	}
+	catch (Exception & ex)
+	{
+		cerr << ex.getMessage() << endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,272 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			batchRunner.cpp
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+**********************************************************************/
+
+#include "batchRunner.h"
+#include "exception.h"
+#include "prng.h"
+
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+/**********************************************************************
+* Purpose:
+*	To construct a BatchRunner for a range of deals, with one thread
+*	per core and the default limits.
+*
+* Precondition:
+*	The first and last deals (inclusive) and whether they are seeds
+*	rather than game numbers.
+*
+* Postcondition:
+*	Data members are initialized. An Exception is thrown if the first
+*	deal comes after the last.
+**********************************************************************/
+BatchRunner::BatchRunner(unsigned long long first, unsigned long long last, bool seeded) :
+	m_first(first), m_count(last - first + 1), m_seeded(seeded), m_numThreads(0),
+	m_nodeLimit(SOLVER_DEFAULT_NODE_LIMIT), m_memoryLimit(BATCH_DEFAULT_MEMORY_LIMIT), m_next(0), m_out(nullptr)
+{
+	if (first > last)
+		throw Exception("ERROR: The first deal comes after the last deal.");
+
+	for (int i = 0; i < NUM_SOLVE_STATUSES; i++)
+		m_numResults[i] = 0;
+}
+
+/**********************************************************************
+* Purpose:
+*	To solve every deal of the range on every thread and write a line
+*	for each after the header line.
+*
+* Precondition:
+*	The stream to write to, which no other thread writes to while the
+*	deals are solved.
+*
+* Postcondition:
+*	Every deal has been solved or given up on, a line has been written
+*	for each, and the counts of how the searches ended are updated.
+**********************************************************************/
+void BatchRunner::Run(std::ostream & out)
+{
+	int numThreads = m_numThreads;	//Number of threads to run
+
+	if (numThreads <= 0)
+		numThreads = static_cast<int>(std::thread::hardware_concurrency());
+
+	if (numThreads <= 0)
+		numThreads = 1;
+
+	std::unique_ptr<std::thread[]> threads(new std::thread[numThreads]);	//Thread of each worker
+
+	m_out = &out;
+	m_next = 0;
+
+	for (int i = 0; i < NUM_SOLVE_STATUSES; i++)
+		m_numResults[i] = 0;
+
+	out << "deal,status,solution_length,nodes_expanded,milliseconds\n";
+
+	for (int i = 0; i < numThreads; i++)
+		threads[i] = std::thread(&BatchRunner::Work, this);
+
+	for (int i = 0; i < numThreads; i++)
+		threads[i].join();
+
+	out.flush();
+	m_out = nullptr;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of deals of the last run whose search ended
+*	a given way.
+*
+* Precondition:
+*	A SolveStatus.
+*
+* Postcondition:
+*	The number of deals is returned.
+**********************************************************************/
+long long BatchRunner::GetNumResults(SolveStatus status) const
+{
+	return m_numResults[status];
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the number of threads a run uses.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The number of threads is returned, zero for one per core.
+**********************************************************************/
+int BatchRunner::GetNumThreads() const
+{
+	return m_numThreads;
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the number of threads a run uses.
+*
+* Precondition:
+*	The number of threads, zero (or less) for one per core.
+*
+* Postcondition:
+*	The number of threads is set.
+**********************************************************************/
+void BatchRunner::SetNumThreads(int numThreads)
+{
+	m_numThreads = numThreads;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most positions the search of one deal may expand.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The node limit is returned.
+**********************************************************************/
+int BatchRunner::GetNodeLimit() const
+{
+	return m_nodeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the most positions the search of one deal may expand.
+*
+* Precondition:
+*	The node limit.
+*
+* Postcondition:
+*	The node limit is set.
+**********************************************************************/
+void BatchRunner::SetNodeLimit(int nodeLimit)
+{
+	m_nodeLimit = nodeLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To return the most bytes the search of one deal may use.
+*
+* Precondition:
+*	<None>
+*
+* Postcondition:
+*	The memory limit is returned.
+**********************************************************************/
+size_t BatchRunner::GetMemoryLimit() const
+{
+	return m_memoryLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To set the most bytes the search of one deal may use. Every thread
+*	may use this much at once.
+*
+* Precondition:
+*	The memory limit in bytes.
+*
+* Postcondition:
+*	The memory limit is set.
+**********************************************************************/
+void BatchRunner::SetMemoryLimit(size_t memoryLimit)
+{
+	m_memoryLimit = memoryLimit;
+}
+
+/**********************************************************************
+* Purpose:
+*	To solve chunks of deals on one thread until none are left. The
+*	thread's Solver keeps its storage from deal to deal, and the lines
+*	of a chunk are gathered first so the output is locked once per
+*	chunk.
+*
+* Precondition:
+*	Called on its own thread by Run().
+*
+* Postcondition:
+*	Every deal has been taken by some thread.
+**********************************************************************/
+void BatchRunner::Work()
+{
+	Solver solver(m_nodeLimit, m_memoryLimit);	//Search of this thread
+	std::ostringstream lines;					//Lines of the chunk being solved
+
+	lines << std::fixed << std::setprecision(3);
+
+	for (;;)
+	{
+		unsigned long long first = m_next.fetch_add(BATCH_CHUNK);	//Index of the chunk's first deal
+
+		if (first >= m_count)
+			return;
+
+		unsigned long long last = (m_count - first < static_cast<unsigned long long>(BATCH_CHUNK))
+			? m_count : first + BATCH_CHUNK;	//Index past the chunk's last deal
+
+		for (unsigned long long i = first; i < last; i++)
+		{
+			unsigned long long deal = m_first + i;	//Deal being solved
+			Board board = DealBoard(deal);			//Its starting position
+
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();	//When its search began
+			SolveStatus status = solver.Solve(board);	//How its search ended
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+			m_numResults[status]++;
+
+			lines << deal << ',' << SolveStatusName(status) << ',';
+
+			if (status == SOLVE_SOLVED)
+				lines << solver.GetSolution().getLength();
+
+			lines << ',' << solver.GetNodesExpanded() << ',' << elapsed.count() << '\n';
+		}
+
+		{
+			std::lock_guard<std::mutex> guard(m_outLock);
+			*m_out << lines.str();
+		}
+
+		lines.str("");
+	}
+}
+
+/**********************************************************************
+* Purpose:
+*	To deal the board of a deal: the classic deal of a game number, or
+*	a Deck shuffled by a Prng seeded with the deal.
+*
+* Precondition:
+*	A deal of the range.
+*
+* Postcondition:
+*	The starting position of the deal is returned.
+**********************************************************************/
+Board BatchRunner::DealBoard(unsigned long long deal) const
+{
+	if (!m_seeded)
+		return Board(static_cast<unsigned int>(deal));
+
+	Deck deck;				//Deck to shuffle
+	Prng generator(deal);	//Generator seeded with the deal
+
+	deck.Shuffle(generator);
+
+	return Board(deck);
+}
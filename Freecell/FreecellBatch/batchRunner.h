@@ -0,0 +1,156 @@
+/**********************************************************************
+* Author:			Molli Drivdahl
+* Filename:			batchRunner.h
+* Date Created:		10/17/26
+* Modifications:	10/17/26
+*
+* Class: BatchRunner
+*
+* Purpose:
+*	This class solves every deal in a range with the Solver and writes
+*	one line of comma separated values per deal: the deal, how its
+*	search ended, the length of its solution, the positions expanded,
+*	and the milliseconds it took. A deal is either a classic game
+*	number (as Board(unsigned int) deals it) or a seed for a Prng that
+*	shuffles the Deck.
+*
+*	One thread runs per core, each with its own one-thread Solver, so
+*	the searches never share anything and each gives the same result
+*	every time. The threads take deals BATCH_CHUNK at a time from a
+*	shared counter, so a thread that gets easy deals simply takes more,
+*	and each thread writes a chunk's lines all at once. The lines come
+*	out in the order the chunks finish, not in the order of the deals.
+*
+* Manager functions:
+*	BatchRunner(unsigned long long first, unsigned long long last,
+*		bool seeded)
+*		Creates a runner for the deals first to last (inclusive), as
+*		seeds if seeded is true, with one thread per core and the
+*		Solver's default limits.
+*
+* Methods:
+*	void Run(std::ostream & out)
+*		Solves every deal and writes the header line and a line per
+*		deal to out.
+*
+*	long long GetNumResults(SolveStatus status) const
+*		Returns the number of deals of the last run whose search ended
+*		the given way.
+*
+*	int GetNumThreads() const
+*	void SetNumThreads(int numThreads)
+*		Get and set the number of threads (zero for one per core).
+*
+*	int GetNodeLimit() const
+*	void SetNodeLimit(int nodeLimit)
+*		Get and set the most positions the search of one deal may
+*		expand.
+*
+*	size_t GetMemoryLimit() const
+*	void SetMemoryLimit(size_t memoryLimit)
+*		Get and set the most bytes the search of one deal may use.
+*
+* char * SolveStatusName(SolveStatus status)
+*	Returns the short name of how a search ended, as written in the
+*	output.
+**********************************************************************/
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "solver.h"
+
+#include <atomic>
+#include <mutex>
+#include <ostream>
+
+const int BATCH_CHUNK = 16;											//Deals a thread takes at once
+const size_t BATCH_DEFAULT_MEMORY_LIMIT = static_cast<size_t>(64) << 20;	//Bytes each deal's search may use
+
+class BatchRunner
+{
+public:
+	//3-Arg Overloaded Ctor
+	BatchRunner(unsigned long long first, unsigned long long last, bool seeded);
+
+	//Copy Ctor (not allowed, the counters cannot be copied)
+	BatchRunner(const BatchRunner & copy) = delete;
+
+	//Default Dtor
+	~BatchRunner() = default;
+
+	//Assignment Operator (not allowed, the counters cannot be copied)
+	BatchRunner & operator=(const BatchRunner & rhs) = delete;
+
+	//Solves every deal and writes a line for each
+	void Run(std::ostream & out);
+
+	//Returns the number of deals whose search ended a given way
+	long long GetNumResults(SolveStatus status) const;
+
+	//Getter for m_numThreads
+	int GetNumThreads() const;
+
+	//Setter for m_numThreads
+	void SetNumThreads(int numThreads);
+
+	//Getter for m_nodeLimit
+	int GetNodeLimit() const;
+
+	//Setter for m_nodeLimit
+	void SetNodeLimit(int nodeLimit);
+
+	//Getter for m_memoryLimit
+	size_t GetMemoryLimit() const;
+
+	//Setter for m_memoryLimit
+	void SetMemoryLimit(size_t memoryLimit);
+
+private:
+	//Solves chunks of deals on one thread until none are left
+	void Work();
+
+	//Deals the board of a deal
+	Board DealBoard(unsigned long long deal) const;
+
+	unsigned long long m_first;					//First deal
+	unsigned long long m_count;					//Number of deals
+	bool m_seeded;								//Flags that deals are seeds, not game numbers
+	int m_numThreads;							//Threads to run, zero for one per core
+	int m_nodeLimit;							//Most positions each search may expand
+	size_t m_memoryLimit;						//Most bytes each search may use
+	std::atomic<unsigned long long> m_next;		//Index of the next deal to take
+	std::atomic<long long> m_numResults[NUM_SOLVE_STATUSES];	//Deals counted by how their search ended
+	std::ostream * m_out;						//Where the lines are written
+	std::mutex m_outLock;						//Lock for writing lines
+};
+
+/**********************************************************************
+* Purpose:
+*	To return the short name of how a search ended.
+*
+* Precondition:
+*	A SolveStatus.
+*
+* Postcondition:
+*	The name is returned.
+**********************************************************************/
+inline char * SolveStatusName(SolveStatus status)
+{
+	switch (status)
+	{
+		case SOLVE_SOLVED:
+			return "solved";
+		case SOLVE_UNSOLVABLE:
+			return "unsolvable";
+		case SOLVE_NODE_LIMIT:
+			return "node_limit";
+		case SOLVE_MEMORY_LIMIT:
+			return "memory_limit";
+		case SOLVE_TIME_LIMIT:
+			return "time_limit";
+	}
+
+	return "unknown";
+}
+
+#endif //BATCH_RUNNER_H